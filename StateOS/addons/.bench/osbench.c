@@ -0,0 +1,294 @@
+/******************************************************************************
+
+    @file    StateOS: osbench.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   Microbenchmark of uncontended kernel operations.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "osbench.h"
+#include <stdlib.h>
+
+#if !defined(DWT)
+#error osbench requires the DWT cycle counter!
+#endif
+
+#define BENCH_LOOPS 1000
+
+// timers of the timers benchmark expire between BENCH_DELAY and 2 * BENCH_DELAY ticks
+#define BENCH_DELAY (cnt_t)(60 * (OS_FREQUENCY))
+
+// fragmentation of the heap is sampled every BENCH_SAMPLE operations of the heap benchmark
+#define BENCH_SAMPLE 64
+
+static_SEM(bench_sem, 0, semBinary);
+static_MUT(bench_mut);
+static_FLG(bench_flg, 0);
+
+/* -------------------------------------------------------------------------- */
+static
+uint32_t priv_bench_avg( uint32_t sum, uint32_t overhead )
+/* -------------------------------------------------------------------------- */
+{
+	sum /= BENCH_LOOPS;
+
+	return (sum > overhead) ? sum - overhead : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+uint32_t priv_bench_overhead( void )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t t0, t1;
+	uint32_t overhead = 0;
+	unsigned i;
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	for (i = 0; i < BENCH_LOOPS; i++)
+	{
+		t0 = DWT->CYCCNT;
+		t1 = DWT->CYCCNT;
+		overhead += t1 - t0;
+	}
+
+	return overhead / BENCH_LOOPS;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+uint32_t priv_bench_random( uint32_t *seed )
+/* -------------------------------------------------------------------------- */
+{
+	*seed = *seed * 1664525U + 1013904223U;
+
+	return *seed >> 8;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+cnt_t priv_bench_delay( uint32_t *seed )
+/* -------------------------------------------------------------------------- */
+{
+	return BENCH_DELAY + (cnt_t)priv_bench_random(seed) % BENCH_DELAY;
+}
+
+/* -------------------------------------------------------------------------- */
+void bench_run( bench_t *result )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t t0, t1, t2;
+	uint32_t overhead, take = 0, give = 0;
+	unsigned i;
+
+	assert_tsk_context();
+	assert(result);
+
+	overhead = priv_bench_overhead();
+
+	for (i = 0; i < BENCH_LOOPS; i++)
+	{
+		t0 = DWT->CYCCNT;
+		sem_give(bench_sem);
+		t1 = DWT->CYCCNT;
+		sem_take(bench_sem);
+		t2 = DWT->CYCCNT;
+		give += t1 - t0;
+		take += t2 - t1;
+	}
+	result->sem_give = priv_bench_avg(give, overhead);
+	result->sem_take = priv_bench_avg(take, overhead);
+
+	take = give = 0;
+	for (i = 0; i < BENCH_LOOPS; i++)
+	{
+		t0 = DWT->CYCCNT;
+		mut_lock(bench_mut);
+		t1 = DWT->CYCCNT;
+		mut_unlock(bench_mut);
+		t2 = DWT->CYCCNT;
+		take += t1 - t0;
+		give += t2 - t1;
+	}
+	result->mut_lock   = priv_bench_avg(take, overhead);
+	result->mut_unlock = priv_bench_avg(give, overhead);
+
+	give = 0;
+	for (i = 0; i < BENCH_LOOPS; i++)
+	{
+		t0 = DWT->CYCCNT;
+		flg_give(bench_flg, 1U << (i % 32));
+		t1 = DWT->CYCCNT;
+		give += t1 - t0;
+	}
+	flg_clear(bench_flg, ~0U);
+	result->flg_give = priv_bench_avg(give, overhead);
+}
+
+/* -------------------------------------------------------------------------- */
+void bench_timers( bench_tmr_t *result, tmr_t *tab, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t t0, t1, t2;
+	uint32_t overhead, start = 0, reset = 0;
+	uint32_t seed = 1;
+	unsigned i;
+	cnt_t    delay;
+	tmr_t  * tmr;
+
+	assert_tsk_context();
+	assert(result);
+	assert(tab);
+	assert(count);
+
+	overhead = priv_bench_overhead();
+
+	for (i = 0; i < count; i++)
+	{
+		tmr_init(&tab[i], NULL);
+		tmr_startFor(&tab[i], priv_bench_delay(&seed));
+	}
+
+	for (i = 0; i < BENCH_LOOPS; i++)
+	{
+		tmr = &tab[(seed >> 8) % count];
+		delay = priv_bench_delay(&seed);
+		t0 = DWT->CYCCNT;
+		tmr_reset(tmr);
+		t1 = DWT->CYCCNT;
+		tmr_startFor(tmr, delay);
+		t2 = DWT->CYCCNT;
+		reset += t1 - t0;
+		start += t2 - t1;
+	}
+
+	for (i = 0; i < count; i++)
+		tmr_reset(&tab[i]);
+
+	result->count     = count;
+	result->tmr_start = priv_bench_avg(start, overhead);
+	result->tmr_reset = priv_bench_avg(reset, overhead);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE
+
+/* -------------------------------------------------------------------------- */
+void bench_heap( bench_heap_t *result, void **tab, unsigned count, unsigned ops, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	uint32_t t0, t1, dt;
+	uint32_t overhead, seed = 1;
+	uint64_t take = 0, give = 0;
+	unsigned takes = 0, gives = 0, samples = 0;
+	unsigned i, frag = 0;
+	uint32_t rnd;
+	size_t   len;
+	void   * ptr;
+	void  ** slot;
+	hps_t    hps;
+
+	assert_tsk_context();
+	assert(result);
+	assert(tab);
+	assert(count);
+	assert(size >= 8);
+
+	overhead = priv_bench_overhead();
+
+	memset(result, 0, sizeof(bench_heap_t));
+	memset(tab, 0, count * sizeof(void *));
+
+	for (i = 0; i < ops; i++)
+	{
+		rnd  = priv_bench_random(&seed);
+		slot = &tab[rnd % count];
+		len  = 8 + priv_bench_random(&seed) % (size - 7);
+
+		if (*slot == NULL || (rnd >> 12) % 4 == 0)
+		{
+			t0 = DWT->CYCCNT;
+			if (*slot != NULL)
+				ptr = realloc(*slot, len);
+			else
+			if ((rnd >> 12) % 8 == 1)
+				ptr = aligned_alloc(64, ALIGNED(len, 64));
+			else
+				ptr = malloc(len);
+			t1 = DWT->CYCCNT;
+			if (ptr != NULL)
+				*slot = ptr;
+			else
+				result->failures++;
+			dt = t1 - t0 > overhead ? t1 - t0 - overhead : 0;
+			if (result->alloc_max < dt)
+				result->alloc_max = dt;
+			take += dt;
+			takes++;
+		}
+		else
+		{
+			t0 = DWT->CYCCNT;
+			free(*slot);
+			t1 = DWT->CYCCNT;
+			*slot = NULL;
+			dt = t1 - t0 > overhead ? t1 - t0 - overhead : 0;
+			if (result->free_max < dt)
+				result->free_max = dt;
+			give += dt;
+			gives++;
+		}
+
+		if (i % BENCH_SAMPLE == 0)
+		{
+			sys_heapStats(&hps);
+			if (hps.free > 0)
+			{
+				frag += (unsigned)(1000 - (uint64_t)hps.largest * 1000 / hps.free);
+				samples++;
+			}
+		}
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		free(tab[i]);
+		tab[i] = NULL;
+	}
+
+	result->ops   = ops;
+	result->alloc = takes   ? (uint32_t)(take / takes) : 0;
+	result->free  = gives   ? (uint32_t)(give / gives) : 0;
+	result->frag  = samples ? frag / samples           : 0;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_HEAP_SIZE
@@ -0,0 +1,174 @@
+/******************************************************************************
+
+    @file    StateOS: osbench.h
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   Microbenchmark of uncontended kernel operations.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_BENCH_H
+#define __STATEOS_BENCH_H
+
+#include "os.h"
+
+/******************************************************************************
+ *
+ * Name              : benchmark results
+ *
+ * Description       : average number of cpu cycles spent in a single uncontended operation,
+ *                     measured with the DWT cycle counter (the cost of reading the counter is subtracted)
+ *
+ ******************************************************************************/
+
+typedef struct __bench
+{
+	uint32_t sem_take;   // sem_take on a semaphore with a positive counter
+	uint32_t sem_give;   // sem_give on a semaphore without waiting tasks
+	uint32_t mut_lock;   // mut_lock on an unlocked fast mutex
+	uint32_t mut_unlock; // mut_unlock on a fast mutex without waiting tasks
+	uint32_t flg_give;   // flg_give on a flag object without waiting tasks
+
+}	bench_t;
+
+/******************************************************************************
+ *
+ * Name              : timers queue benchmark results
+ *
+ * Description       : average number of cpu cycles spent in a single timer operation
+ *                     while a given number of timers is armed with random delays
+ *
+ ******************************************************************************/
+
+typedef struct __bench_tmr
+{
+	unsigned count;      // number of armed timers
+	uint32_t tmr_start;  // tmr_start of a stopped timer (insertion into the timers queue)
+	uint32_t tmr_reset;  // tmr_reset of an armed timer (removal from the timers queue)
+
+}	bench_tmr_t;
+
+/******************************************************************************
+ *
+ * Name              : heap benchmark results
+ *
+ * Description       : cost of heap operations and fragmentation of the dedicated heap memory (OS_HEAP_SIZE)
+ *                     while a random trace of allocations and releases is replayed
+ *
+ ******************************************************************************/
+
+typedef struct __bench_heap
+{
+	unsigned ops;        // number of operations of the trace
+	unsigned failures;   // number of failed allocations
+	uint32_t alloc;      // average number of cpu cycles spent in malloc, aligned_alloc or realloc
+	uint32_t alloc_max;  // maximum number of cpu cycles spent in malloc, aligned_alloc or realloc
+	uint32_t free;       // average number of cpu cycles spent in free
+	uint32_t free_max;   // maximum number of cpu cycles spent in free
+	unsigned frag;       // average fragmentation of the heap (1 - largest free block / free memory) in per mille
+
+}	bench_heap_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : bench_run
+ *
+ * Description       : measure the cost of uncontended operations on semaphores, fast mutexes and flags
+ *
+ * Parameters
+ *   result          : pointer to the structure receiving the results
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     build the application with OS_FAST_PATH == 0 and OS_FAST_PATH == 1 to compare the locked path
+ *                     with the atomic fast path, OS_TRACE_SIZE must be zero in both cases
+ *
+ ******************************************************************************/
+
+void bench_run( bench_t *result );
+
+/******************************************************************************
+ *
+ * Name              : bench_timers
+ *
+ * Description       : arm given number of timers with random delays and measure the cost of starting and stopping
+ *                     a timer of the timers queue, all timers are stopped when the function returns
+ *
+ * Parameters
+ *   result          : pointer to the structure receiving the results
+ *   tab             : pointer to the table of timers used by the benchmark (its content is overwritten)
+ *   count           : number of timers in the table
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     call the function with increasing number of timers (e.g. 1000, 2000, 5000, 10000)
+ *                     and build the application with OS_TIMER_WHEEL == 0 and OS_TIMER_WHEEL == 1 to compare
+ *                     the sorted list with the timing wheel, OS_TRACE_SIZE must be zero in both cases
+ *
+ ******************************************************************************/
+
+void bench_timers( bench_tmr_t *result, tmr_t *tab, unsigned count );
+
+/******************************************************************************
+ *
+ * Name              : bench_heap
+ *
+ * Description       : replay a random trace of heap operations (malloc, aligned_alloc, realloc and free)
+ *                     on given number of memory slots and measure their cost and the fragmentation of the heap,
+ *                     the trace depends only on the parameters, all slots are released when the function returns
+ *
+ * Parameters
+ *   result          : pointer to the structure receiving the results
+ *   tab             : pointer to the table of memory slots used by the benchmark (its content is overwritten)
+ *   count           : number of memory slots in the table (max number of live memory segments)
+ *   ops             : number of operations of the trace
+ *   size            : max size of an allocated memory segment (min size is 8 bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     the heap should be empty when the function is called (no other allocations in progress)
+ *                     build the application with OS_HEAP_TLSF == 0 and OS_HEAP_TLSF == 1 to compare
+ *                     the first-fit allocator with the TLSF allocator, OS_TRACE_SIZE must be zero in both cases,
+ *                     e.g. OS_HEAP_SIZE == 65536, count == 32 and 64, ops == 100000, size == 2560
+ *
+ ******************************************************************************/
+
+#if OS_HEAP_SIZE
+void bench_heap( bench_heap_t *result, void **tab, unsigned count, unsigned ops, size_t size );
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif//__STATEOS_BENCH_H
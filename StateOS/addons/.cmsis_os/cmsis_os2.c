@@ -121,12 +121,18 @@ int32_t osKernelRestoreLock (int32_t lock)
 
 uint32_t osKernelSuspend (void)
 {
-	return 0U;
+	if (IS_IRQ_MODE() || IS_IRQ_MASKED())
+		return 0U;
+
+	return core_sys_suspend();
 }
 
 void osKernelResume (uint32_t sleep_ticks)
 {
-	(void) sleep_ticks;
+	if (IS_IRQ_MODE() || IS_IRQ_MASKED())
+		return;
+
+	core_sys_resume(sleep_ticks);
 }
 
 uint32_t osKernelGetTickCount (void)
@@ -464,10 +470,10 @@ uint32_t osThreadGetCount (void)
 	{
 		count++;
 
-		for (tsk = IDLE.hdr.next; tsk != &IDLE; tsk = tsk->hdr.next)
+		for (tsk = core_tsk_next(&IDLE); tsk != &IDLE; tsk = core_tsk_next(tsk))
 			count++;
 
-		for (tmr = WAIT.hdr.next; tmr != &WAIT; tmr = tmr->hdr.next)
+		for (tmr = core_tmr_next(&WAIT); tmr != &WAIT; tmr = core_tmr_next(tmr))
 			if (tmr->hdr.id == ID_READY)
 				count++;
 	}
@@ -489,10 +495,10 @@ uint32_t osThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items)
 	{
 		thread_array[count++] = &IDLE;
 
-		for (tsk = IDLE.hdr.next; (tsk != &IDLE) && (count < array_items); tsk = tsk->hdr.next)
+		for (tsk = core_tsk_next(&IDLE); (tsk != &IDLE) && (count < array_items); tsk = core_tsk_next(tsk))
 			thread_array[count++] = tsk;
 
-		for (tmr = WAIT.hdr.next; (tmr != &WAIT) && (count < array_items); tmr = tmr->hdr.next)
+		for (tmr = core_tmr_next(&WAIT); (tmr != &WAIT) && (count < array_items); tmr = core_tmr_next(tmr))
 			if (tmr->hdr.id == ID_READY)
 				thread_array[count++] = tmr;
 	}
@@ -1229,9 +1235,9 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
 	if (mq == NULL && data == NULL)
 	{
 		mq = malloc(osMessageQueueCbSize + size);
-		data = mq->buf;
 		if (mq == NULL)
 			return NULL;
+		data = mq->buf;
 	}
 	else
 	if (mq == NULL)
@@ -1250,9 +1256,9 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
 
 	sys_lock();
 	{
-		box_init(&mq->box, msg_count, data, msg_size);
-		if (attr == NULL || attr->cb_mem == NULL || attr->cb_size == 0U) mq->box.obj.res = mq;
-		else if (attr->mq_mem == NULL || attr->mq_size == 0U) mq->box.obj.res = data;
+		prq_init(&mq->prq, msg_size, data, size);
+		if (attr == NULL || attr->cb_mem == NULL || attr->cb_size == 0U) mq->prq.obj.res = mq;
+		else if (attr->mq_mem == NULL || attr->mq_size == 0U) mq->prq.obj.res = data;
 		mq->flags = flags;
 		mq->name = (attr == NULL) ? NULL : attr->name;
 	}
@@ -1275,15 +1281,13 @@ osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uin
 {
 	osMessageQueue_t *mq = mq_id;
 
-	(void)msg_prio; /* message priority is ignored */
-
 	if ((mq_id == NULL) || (msg_ptr == NULL))
 		return osErrorParameter;
 
 	if ((IS_IRQ_MODE() || IS_IRQ_MASKED()) && (timeout != 0U))
 		return osErrorParameter;
 
-	switch (box_sendFor(&mq->box, msg_ptr, timeout))
+	switch (prq_sendFor(&mq->prq, msg_ptr, msg_prio, timeout))
 	{
 		case E_SUCCESS: return osOK;
 		case E_TIMEOUT: return osErrorTimeout;
@@ -1294,8 +1298,7 @@ osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uin
 osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout)
 {
 	osMessageQueue_t *mq = mq_id;
-
-	(void)msg_prio; /* message priority is ignored */
+	unsigned          prio;
 
 	if ((mq_id == NULL) || (msg_ptr == NULL))
 		return osErrorParameter;
@@ -1303,12 +1306,17 @@ osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *
 	if ((IS_IRQ_MODE() || IS_IRQ_MASKED()) && (timeout != 0U))
 		return osErrorParameter;
 
-	switch (box_waitFor(&mq->box, msg_ptr, timeout))
+	switch (prq_waitFor(&mq->prq, msg_ptr, &prio, timeout))
 	{
-		case E_SUCCESS: return osOK;
+		case E_SUCCESS: break;
 		case E_TIMEOUT: return osErrorTimeout;
 		default:        return osErrorResource;
 	}
+
+	if (msg_prio != NULL)
+		*msg_prio = (uint8_t)prio;
+
+	return osOK;
 }
 
 uint32_t osMessageQueueGetCapacity (osMessageQueueId_t mq_id)
@@ -1318,7 +1326,7 @@ uint32_t osMessageQueueGetCapacity (osMessageQueueId_t mq_id)
 	if (mq_id == NULL)
 		return 0U;
 
-	return mq->box.limit;
+	return mq->prq.limit;
 }
 
 uint32_t osMessageQueueGetMsgSize (osMessageQueueId_t mq_id)
@@ -1328,7 +1336,7 @@ uint32_t osMessageQueueGetMsgSize (osMessageQueueId_t mq_id)
 	if (mq_id == NULL)
 		return 0U;
 
-	return mq->box.size;
+	return mq->prq.size;
 }
 
 uint32_t osMessageQueueGetCount (osMessageQueueId_t mq_id)
@@ -1338,7 +1346,7 @@ uint32_t osMessageQueueGetCount (osMessageQueueId_t mq_id)
 	if (mq_id == NULL)
 		return 0U;
 
-	return mq->box.count;
+	return mq->prq.count;
 }
 
 uint32_t osMessageQueueGetSpace (osMessageQueueId_t mq_id)
@@ -1351,7 +1359,7 @@ uint32_t osMessageQueueGetSpace (osMessageQueueId_t mq_id)
 
 	sys_lock();
 	{
-		count = mq->box.limit - mq->box.count;
+		count = mq->prq.limit - mq->prq.count;
 	}
 	sys_unlock();
 
@@ -1367,7 +1375,7 @@ osStatus_t osMessageQueueReset (osMessageQueueId_t mq_id)
 	if (mq_id == NULL)
 		return osErrorParameter;
 
-	box_reset(&mq->box);
+	prq_reset(&mq->prq);
 
 	return osOK;
 }
@@ -1381,7 +1389,7 @@ osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id)
 	if (mq_id == NULL)
 		return osErrorParameter;
 
-	box_destroy(&mq->box);
+	prq_destroy(&mq->prq);
 
 	return osOK;
 }
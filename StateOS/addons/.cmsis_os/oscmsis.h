@@ -142,16 +142,16 @@ typedef struct __MemoryPool osMemoryPool_t;
 
 struct __MessageQueue
 {
-	box_t        box;   // StateOS mailbox object
+	prq_t        prq;   // StateOS priority queue object
 	uint32_t     flags; // attribute bits
-	const char * name;  // mailbox name
-	char         buf[]; // mailbox buffer
+	const char * name;  // priority queue name
+	prn_t        buf[]; // priority queue buffer
 };
 
 typedef struct __MessageQueue osMessageQueue_t;
 
 #define osMessageQueueCbSize sizeof(osMessageQueue_t)
-#define osMessageQueueMemSize(count, size) (count*size)
+#define osMessageQueueMemSize(count, size) PRQ_SIZE(count, size)
 
 /* -------------------------------------------------------------------------- */
 
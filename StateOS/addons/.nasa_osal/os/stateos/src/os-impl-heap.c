@@ -28,6 +28,7 @@
                                     INCLUDE FILES
  ***************************************************************************************/
 
+#include "os-stateos.h"
 #include "os-shared-heap.h"
 
 /****************************************************************************************
@@ -44,8 +45,20 @@
  *-----------------------------------------------------------------*/
 int32 OS_HeapGetInfo_Impl(OS_heap_prop_t *heap_prop)
 {
+#if OS_HEAP_SIZE
+    hps_t hps;
+
+    sys_heapStats(&hps);
+
+    heap_prop->free_bytes         = hps.free;
+    heap_prop->free_blocks        = OSAL_BLOCKCOUNT_C(hps.freeBlocks);
+    heap_prop->largest_free_block = hps.largest;
+
+    return OS_SUCCESS;
+#else
     (void) heap_prop;
 
     return OS_ERR_NOT_IMPLEMENTED;
+#endif
 
 } /* end OS_HeapGetInfo_Impl */
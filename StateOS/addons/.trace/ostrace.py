@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+    @file    StateOS: ostrace.py
+    @author  Rajmund Szymanski
+    @brief   Host decoder of the StateOS kernel trace (OS_TRACE_SIZE).
+
+    Converts a stream of trace records (trc_t, as read by trc_read and sent
+    to the host via UART / SWO) to the Chrome trace event format (JSON),
+    which can be viewed in chrome://tracing or https://ui.perfetto.dev
+
+    usage: ostrace.py [-f FREQ] [-s SYMBOLS] [-o OUTPUT] INPUT
+
+      INPUT    binary file with trace records
+      FREQ     frequency of the trace counter in Hz (DWT: core clock frequency)
+      SYMBOLS  symbol table of the application (output of: arm-none-eabi-nm app.elf)
+      OUTPUT   output file (default: standard output)
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+# trc_t: time, code, seq, obj, arg (little-endian, 16 bytes)
+RECORD = struct.Struct('<IHHII')
+
+# must be consistent with enum __trc_code (oskernel.h)
+CODES = [
+	'None', 'Switch', 'Wait', 'Wakeup', 'Timer',
+	'SemTake', 'SemGive', 'MtxTake', 'MtxGive', 'MutTake', 'MutGive',
+	'FlgTake', 'SigTake', 'BarTake', 'LstTake',
+	'BoxTake', 'BoxGive', 'MsgTake', 'MsgGive', 'StmTake', 'StmGive',
+	'EvqTake', 'EvqGive', 'JobTake', 'JobGive', 'PrqTake', 'PrqGive',
+]
+
+EVENTS = { 0: 'E_SUCCESS', -1: 'E_FAILURE', -2: 'E_STOPPED', -3: 'E_DELETED', -4: 'E_TIMEOUT' }
+
+def load_symbols(path):
+	symbols = {}
+	if path:
+		with open(path) as f:
+			for line in f:
+				fields = line.split()
+				if len(fields) == 3:
+					try:
+						symbols[int(fields[0], 16)] = fields[2]
+					except ValueError:
+						pass
+	return symbols
+
+def records(data):
+	for pos in range(0, len(data) - RECORD.size + 1, RECORD.size):
+		yield RECORD.unpack_from(data, pos)
+
+def decode(data, freq, symbols):
+	name = lambda addr: symbols.get(addr, '0x%08X' % addr)
+	events = []
+	tasks = {}
+	cur = None
+	base = None
+	last = 0
+	high = 0
+	seq = None
+
+	def tid(addr):
+		if addr not in tasks:
+			tasks[addr] = len(tasks) + 1
+			events.append({ 'ph': 'M', 'pid': 0, 'tid': tasks[addr], 'name': 'thread_name', 'args': { 'name': name(addr) } })
+		return tasks[addr]
+
+	for time, code, num, obj, arg in records(data):
+		# extension of the 32-bit trace counter
+		if time < last:
+			high += 1 << 32
+		last = time
+		time += high
+		if base is None:
+			base = time
+		ts = (time - base) * 1e6 / freq
+
+		if seq is not None and num != (seq + 1) & 0xFFFF:
+			events.append({ 'ph': 'i', 's': 'g', 'pid': 0, 'tid': 0, 'ts': ts, 'name': 'lost', 'args': { 'records': (num - seq - 1) & 0xFFFF } })
+		seq = num
+
+		what = CODES[code] if code < len(CODES) else 'Code%d' % code
+
+		if what == 'Switch':
+			events.append({ 'ph': 'E', 'pid': 0, 'tid': tid(obj), 'ts': ts })
+			events.append({ 'ph': 'B', 'pid': 0, 'tid': tid(arg), 'ts': ts, 'name': name(arg) })
+			cur = arg
+		elif what == 'Wait':
+			events.append({ 'ph': 'i', 's': 't', 'pid': 0, 'tid': tid(obj), 'ts': ts, 'name': 'Wait', 'args': { 'obj': name(arg) } })
+		elif what == 'Wakeup':
+			event = struct.unpack('<i', struct.pack('<I', arg))[0]
+			events.append({ 'ph': 'i', 's': 't', 'pid': 0, 'tid': tid(obj), 'ts': ts, 'name': 'Wakeup', 'args': { 'event': EVENTS.get(event, event) } })
+		else:
+			events.append({ 'ph': 'i', 's': 't', 'pid': 0, 'tid': tid(cur) if cur is not None else 0, 'ts': ts, 'name': what, 'args': { 'obj': name(obj), 'arg': arg } })
+
+	return { 'traceEvents': events, 'displayTimeUnit': 'ns' }
+
+def main():
+	parser = argparse.ArgumentParser(description = 'StateOS kernel trace decoder')
+	parser.add_argument('input')
+	parser.add_argument('-f', '--freq', type = float, default = 1e6)
+	parser.add_argument('-s', '--symbols')
+	parser.add_argument('-o', '--output')
+	args = parser.parse_args()
+
+	with open(args.input, 'rb') as f:
+		data = f.read()
+
+	trace = decode(data, args.freq, load_symbols(args.symbols))
+
+	out = open(args.output, 'w') if args.output else sys.stdout
+	json.dump(trace, out, indent = 1)
+	out.write('\n')
+
+if __name__ == '__main__':
+	main()
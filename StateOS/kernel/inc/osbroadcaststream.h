@@ -0,0 +1,1025 @@
+/******************************************************************************
+
+    @file    StateOS: osbroadcaststream.h
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_BST_H
+#define __STATEOS_BST_H
+
+#include "oskernel.h"
+#include "osclock.h"
+
+/******************************************************************************
+ *
+ * Name              : broadcast stream
+ *
+ ******************************************************************************/
+
+typedef struct __bst bst_t, * const bst_id;
+
+struct __bst
+{
+	obj_t    obj;   // object header (producers waiting for space)
+
+	struct __rdr *
+	         rdrs;  // list of readers
+	size_t   limit; // size of the broadcast stream (in bytes)
+	size_t   tail;  // first element to write into data buffer
+	char *   data;  // data buffer
+};
+
+/******************************************************************************
+ *
+ * Name              : broadcast stream reader
+ *
+ ******************************************************************************/
+
+// overrun policies of the reader
+enum
+{
+	rdrDrop = 0,       // the oldest data of the reader is overwritten, the number of dropped bytes is counted
+	rdrBlock,          // the producer waits until the reader frees space
+};
+
+typedef struct __rdr rdr_t, * const rdr_id;
+
+struct __rdr
+{
+	obj_t    obj;   // object header (tasks waiting for data)
+
+	rdr_t  * next;  // next reader of the broadcast stream
+	bst_t  * bst;   // attached broadcast stream
+	unsigned mode;  // overrun policy
+	size_t   lost;  // number of dropped bytes
+
+	size_t   count; // number of bytes available to the reader
+	size_t   head;  // first element to read from data buffer of the broadcast stream
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _BST_INIT
+ *
+ * Description       : create and initialize a broadcast stream object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *   data            : broadcast stream data
+ *
+ * Return            : broadcast stream object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _BST_INIT( _limit, _data ) { _OBJ_INIT(), NULL, _limit, 0, _data }
+
+/******************************************************************************
+ *
+ * Name              : _BST_DATA
+ *
+ * Description       : create a broadcast stream data
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : broadcast stream data
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _BST_DATA( _limit ) (char[_limit]){ 0 }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : OS_BST
+ *
+ * Description       : define and initialize a broadcast stream object
+ *
+ * Parameters
+ *   bst             : name of a pointer to broadcast stream object
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ ******************************************************************************/
+
+#define             OS_BST( bst, limit )                                \
+                       char bst##__buf[limit];                           \
+                       bst_t bst##__bst = _BST_INIT( limit, bst##__buf ); \
+                       bst_id bst = & bst##__bst
+
+/******************************************************************************
+ *
+ * Name              : static_BST
+ *
+ * Description       : define and initialize a static broadcast stream object
+ *
+ * Parameters
+ *   bst             : name of a pointer to broadcast stream object
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ ******************************************************************************/
+
+#define         static_BST( bst, limit )                                \
+                static char bst##__buf[limit];                           \
+                static bst_t bst##__bst = _BST_INIT( limit, bst##__buf ); \
+                static bst_id bst = & bst##__bst
+
+/******************************************************************************
+ *
+ * Name              : BST_INIT
+ *
+ * Description       : create and initialize a broadcast stream object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : broadcast stream object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                BST_INIT( limit ) \
+                      _BST_INIT( limit, _BST_DATA( limit ) )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : BST_CREATE
+ * Alias             : BST_NEW
+ *
+ * Description       : create and initialize a broadcast stream object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : pointer to broadcast stream object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                BST_CREATE( limit ) \
+           (bst_t[]) { BST_INIT  ( limit ) }
+#define                BST_NEW \
+                       BST_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : bst_init
+ *
+ * Description       : initialize a broadcast stream object
+ *
+ * Parameters
+ *   bst             : pointer to broadcast stream object
+ *   data            : broadcast stream data
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void bst_init( bst_t *bst, void *data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : bst_create
+ * Alias             : bst_new
+ *
+ * Description       : create and initialize a new broadcast stream object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : pointer to broadcast stream object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+bst_t *bst_create( size_t limit );
+
+__STATIC_INLINE
+bst_t *bst_new( size_t limit ) { return bst_create(limit); }
+
+/******************************************************************************
+ *
+ * Name              : bst_reset
+ * Alias             : bst_kill
+ *
+ * Description       : discard data of all readers and wake up all tasks waiting to send data with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   bst             : pointer to broadcast stream object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void bst_reset( bst_t *bst );
+
+__STATIC_INLINE
+void bst_kill( bst_t *bst ) { bst_reset(bst); }
+
+/******************************************************************************
+ *
+ * Name              : bst_destroy
+ * Alias             : bst_delete
+ *
+ * Description       : detach all readers, wake up all tasks waiting to send data and all tasks waiting
+ *                     for data of the readers with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   bst             : pointer to broadcast stream object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void bst_destroy( bst_t *bst );
+
+__STATIC_INLINE
+void bst_delete( bst_t *bst ) { bst_destroy(bst); }
+
+/******************************************************************************
+ *
+ * Name              : bst_give
+ * ISR alias         : bst_giveISR
+ *
+ * Description       : try to transfer data to the broadcast stream object,
+ *                     don't wait if there is not enough space for any of the blocking readers
+ *
+ * Parameters
+ *   bst             : pointer to broadcast stream object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *
+ * Return
+ *   E_SUCCESS       : stream data was successfully transferred to the broadcast stream object
+ *   E_FAILURE       : size of the stream data is out of the limit
+ *   E_TIMEOUT       : not enough space in the broadcast stream, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     data is stored once and shared by all readers
+ *
+ ******************************************************************************/
+
+int bst_give( bst_t *bst, const void *data, size_t size );
+
+__STATIC_INLINE
+int bst_giveISR( bst_t *bst, const void *data, size_t size ) { return bst_give(bst, data, size); }
+
+/******************************************************************************
+ *
+ * Name              : bst_sendFor
+ *
+ * Description       : try to transfer data to the broadcast stream object,
+ *                     wait for given duration of time while there is not enough space for any of the blocking readers
+ *
+ * Parameters
+ *   bst             : pointer to broadcast stream object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   delay           : duration of time (maximum number of ticks to wait while there is not enough space)
+ *                     IMMEDIATE: don't wait if there is not enough space
+ *                     INFINITE:  wait indefinitely while there is not enough space
+ *
+ * Return
+ *   E_SUCCESS       : stream data was successfully transferred to the broadcast stream object
+ *   E_FAILURE       : size of the stream data is out of the limit
+ *   E_STOPPED       : broadcast stream object was reseted before the specified timeout expired
+ *   E_DELETED       : broadcast stream object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : there was not enough space in the broadcast stream before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int bst_sendFor( bst_t *bst, const void *data, size_t size, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : bst_sendUntil
+ *
+ * Description       : try to transfer data to the broadcast stream object,
+ *                     wait until given timepoint while there is not enough space for any of the blocking readers
+ *
+ * Parameters
+ *   bst             : pointer to broadcast stream object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : stream data was successfully transferred to the broadcast stream object
+ *   E_FAILURE       : size of the stream data is out of the limit
+ *   E_STOPPED       : broadcast stream object was reseted before the specified timeout expired
+ *   E_DELETED       : broadcast stream object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : there was not enough space in the broadcast stream before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int bst_sendUntil( bst_t *bst, const void *data, size_t size, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : bst_send
+ *
+ * Description       : try to transfer data to the broadcast stream object,
+ *                     wait indefinitely while there is not enough space for any of the blocking readers
+ *
+ * Parameters
+ *   bst             : pointer to broadcast stream object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *
+ * Return
+ *   E_SUCCESS       : stream data was successfully transferred to the broadcast stream object
+ *   E_FAILURE       : size of the stream data is out of the limit
+ *   E_STOPPED       : broadcast stream object was reseted
+ *   E_DELETED       : broadcast stream object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int bst_send( bst_t *bst, const void *data, size_t size ) { return bst_sendFor(bst, data, size, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : bst_space
+ * ISR alias         : bst_spaceISR
+ *
+ * Description       : return the amount of data that can be sent without waiting
+ *
+ * Parameters
+ *   bst             : pointer to broadcast stream object
+ *
+ * Return            : amount of free space for the slowest of the blocking readers (in bytes)
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+size_t bst_space( bst_t *bst );
+
+__STATIC_INLINE
+size_t bst_spaceISR( bst_t *bst ) { return bst_space(bst); }
+
+/******************************************************************************
+ *
+ * Name              : bst_limit
+ * ISR alias         : bst_limitISR
+ *
+ * Description       : return the size of the broadcast stream
+ *
+ * Parameters
+ *   bst             : pointer to broadcast stream object
+ *
+ * Return            : size of the broadcast stream (in bytes)
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+size_t bst_limit( bst_t *bst );
+
+__STATIC_INLINE
+size_t bst_limitISR( bst_t *bst ) { return bst_limit(bst); }
+
+/******************************************************************************
+ *
+ * Name              : _RDR_INIT
+ *
+ * Description       : create and initialize a broadcast stream reader object
+ *
+ * Parameters
+ *   mode            : overrun policy
+ *
+ * Return            : broadcast stream reader object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _RDR_INIT( _mode ) { _OBJ_INIT(), NULL, NULL, _mode, 0, 0, 0 }
+
+/******************************************************************************
+ *
+ * Name              : OS_RDR
+ *
+ * Description       : define and initialize a broadcast stream reader object
+ *
+ * Parameters
+ *   rdr             : name of a pointer to broadcast stream reader object
+ *   mode            : overrun policy
+ *
+ ******************************************************************************/
+
+#define             OS_RDR( rdr, mode )                  \
+                       rdr_t rdr##__rdr = _RDR_INIT( mode ); \
+                       rdr_id rdr = & rdr##__rdr
+
+/******************************************************************************
+ *
+ * Name              : static_RDR
+ *
+ * Description       : define and initialize a static broadcast stream reader object
+ *
+ * Parameters
+ *   rdr             : name of a pointer to broadcast stream reader object
+ *   mode            : overrun policy
+ *
+ ******************************************************************************/
+
+#define         static_RDR( rdr, mode )                  \
+                static rdr_t rdr##__rdr = _RDR_INIT( mode ); \
+                static rdr_id rdr = & rdr##__rdr
+
+/******************************************************************************
+ *
+ * Name              : RDR_INIT
+ *
+ * Description       : create and initialize a broadcast stream reader object
+ *
+ * Parameters
+ *   mode            : overrun policy
+ *
+ * Return            : broadcast stream reader object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                RDR_INIT( mode ) \
+                      _RDR_INIT( mode )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : RDR_CREATE
+ * Alias             : RDR_NEW
+ *
+ * Description       : create and initialize a broadcast stream reader object
+ *
+ * Parameters
+ *   mode            : overrun policy
+ *
+ * Return            : pointer to broadcast stream reader object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                RDR_CREATE( mode ) \
+           (rdr_t[]) { RDR_INIT  ( mode ) }
+#define                RDR_NEW \
+                       RDR_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : rdr_init
+ *
+ * Description       : initialize a broadcast stream reader object
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *   mode            : overrun policy
+ *                     rdrDrop:  the oldest data of the reader is overwritten and counted as lost
+ *                     rdrBlock: the producer waits until the reader frees space
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rdr_init( rdr_t *rdr, unsigned mode );
+
+/******************************************************************************
+ *
+ * Name              : rdr_create
+ * Alias             : rdr_new
+ *
+ * Description       : create and initialize a new broadcast stream reader object
+ *
+ * Parameters
+ *   mode            : overrun policy
+ *
+ * Return            : pointer to broadcast stream reader object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+rdr_t *rdr_create( unsigned mode );
+
+__STATIC_INLINE
+rdr_t *rdr_new( unsigned mode ) { return rdr_create(mode); }
+
+/******************************************************************************
+ *
+ * Name              : rdr_reset
+ * Alias             : rdr_kill
+ *
+ * Description       : discard data of the reader and wake up all waiting tasks with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rdr_reset( rdr_t *rdr );
+
+__STATIC_INLINE
+void rdr_kill( rdr_t *rdr ) { rdr_reset(rdr); }
+
+/******************************************************************************
+ *
+ * Name              : rdr_destroy
+ * Alias             : rdr_delete
+ *
+ * Description       : detach the broadcast stream, wake up all waiting tasks with 'E_DELETED' event value
+ *                     and free allocated resource
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rdr_destroy( rdr_t *rdr );
+
+__STATIC_INLINE
+void rdr_delete( rdr_t *rdr ) { rdr_destroy(rdr); }
+
+/******************************************************************************
+ *
+ * Name              : rdr_attach
+ *
+ * Description       : attach the reader to the broadcast stream object,
+ *                     the reader receives data sent after attachment
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *   bst             : pointer to broadcast stream object
+ *
+ * Return
+ *   E_SUCCESS       : the reader was successfully attached
+ *   E_FAILURE       : the reader has already been attached to a broadcast stream
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int rdr_attach( rdr_t *rdr, bst_t *bst );
+
+/******************************************************************************
+ *
+ * Name              : rdr_detach
+ *
+ * Description       : detach the reader from the broadcast stream object, discard data of the reader
+ *                     and wake up all tasks waiting for data of the reader with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rdr_detach( rdr_t *rdr );
+
+/******************************************************************************
+ *
+ * Name              : rdr_take
+ * Alias             : rdr_tryWait
+ * ISR alias         : rdr_takeISR
+ *
+ * Description       : try to transfer data from the broadcast stream past the cursor of the reader,
+ *                     don't wait if there is no new data
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the broadcast stream
+ *   E_TIMEOUT       : there is no new data for the reader, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int rdr_take( rdr_t *rdr, void *data, size_t size, size_t *read );
+
+__STATIC_INLINE
+int rdr_tryWait( rdr_t *rdr, void *data, size_t size, size_t *read ) { return rdr_take(rdr, data, size, read); }
+
+__STATIC_INLINE
+int rdr_takeISR( rdr_t *rdr, void *data, size_t size, size_t *read ) { return rdr_take(rdr, data, size, read); }
+
+/******************************************************************************
+ *
+ * Name              : rdr_waitFor
+ *
+ * Description       : try to transfer data from the broadcast stream past the cursor of the reader,
+ *                     wait for given duration of time while there is no new data
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *   delay           : duration of time (maximum number of ticks to wait while there is no new data)
+ *                     IMMEDIATE: don't wait if there is no new data
+ *                     INFINITE:  wait indefinitely while there is no new data
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the broadcast stream
+ *   E_STOPPED       : reader object was reseted or detached before the specified timeout expired
+ *   E_DELETED       : reader object or its broadcast stream was deleted before the specified timeout expired
+ *   E_TIMEOUT       : there was no new data for the reader before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int rdr_waitFor( rdr_t *rdr, void *data, size_t size, size_t *read, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : rdr_waitUntil
+ *
+ * Description       : try to transfer data from the broadcast stream past the cursor of the reader,
+ *                     wait until given timepoint while there is no new data
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the broadcast stream
+ *   E_STOPPED       : reader object was reseted or detached before the specified timeout expired
+ *   E_DELETED       : reader object or its broadcast stream was deleted before the specified timeout expired
+ *   E_TIMEOUT       : there was no new data for the reader before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int rdr_waitUntil( rdr_t *rdr, void *data, size_t size, size_t *read, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : rdr_wait
+ *
+ * Description       : try to transfer data from the broadcast stream past the cursor of the reader,
+ *                     wait indefinitely while there is no new data
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the broadcast stream
+ *   E_STOPPED       : reader object was reseted or detached
+ *   E_DELETED       : reader object or its broadcast stream was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int rdr_wait( rdr_t *rdr, void *data, size_t size, size_t *read ) { return rdr_waitFor(rdr, data, size, read, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : rdr_peek
+ * ISR alias         : rdr_peekISR
+ *
+ * Description       : get a contiguous region of the broadcast stream data past the cursor of the reader,
+ *                     the reader can read data directly from the region and then release it with rdr_consume
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *   size            : pointer to the variable getting the size of the region
+ *
+ * Return            : pointer to the beginning of the region
+ *   NULL            : there is no new data for the reader
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the region can be smaller than rdr_count, when the data wraps around the end of the buffer
+ *                     the region of the dropping reader (rdrDrop) can be overwritten by the producer
+ *
+ ******************************************************************************/
+
+const void *rdr_peek( rdr_t *rdr, size_t *size );
+
+__STATIC_INLINE
+const void *rdr_peekISR( rdr_t *rdr, size_t *size ) { return rdr_peek(rdr, size); }
+
+/******************************************************************************
+ *
+ * Name              : rdr_consume
+ * ISR alias         : rdr_consumeISR
+ *
+ * Description       : move the cursor of the reader past data read from the region returned by rdr_peek,
+ *                     resume tasks waiting to send data
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *   size            : amount of data to release
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+void rdr_consume( rdr_t *rdr, size_t size );
+
+__STATIC_INLINE
+void rdr_consumeISR( rdr_t *rdr, size_t size ) { rdr_consume(rdr, size); }
+
+/******************************************************************************
+ *
+ * Name              : rdr_count
+ * ISR alias         : rdr_countISR
+ *
+ * Description       : return the amount of data past the cursor of the reader
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *
+ * Return            : amount of data available to the reader (in bytes)
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+size_t rdr_count( rdr_t *rdr );
+
+__STATIC_INLINE
+size_t rdr_countISR( rdr_t *rdr ) { return rdr_count(rdr); }
+
+/******************************************************************************
+ *
+ * Name              : rdr_lost
+ * ISR alias         : rdr_lostISR
+ *
+ * Description       : return the amount of data dropped by the reader (overrun)
+ *
+ * Parameters
+ *   rdr             : pointer to broadcast stream reader object
+ *
+ * Return            : number of dropped bytes
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+size_t rdr_lost( rdr_t *rdr );
+
+__STATIC_INLINE
+size_t rdr_lostISR( rdr_t *rdr ) { return rdr_lost(rdr); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+namespace stateos {
+
+/******************************************************************************
+ *
+ * Class             : BroadcastStreamT<>
+ *
+ * Description       : create and initialize a broadcast stream object
+ *
+ * Constructor parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ ******************************************************************************/
+
+template<size_t limit_>
+struct BroadcastStreamT : public __bst
+{
+	BroadcastStreamT( void ): __bst _BST_INIT(limit_, data_) {}
+
+	BroadcastStreamT( BroadcastStreamT&& ) = default;
+	BroadcastStreamT( const BroadcastStreamT& ) = delete;
+	BroadcastStreamT& operator=( BroadcastStreamT&& ) = delete;
+	BroadcastStreamT& operator=( const BroadcastStreamT& ) = delete;
+
+	~BroadcastStreamT( void ) { assert(__bst::obj.queue == nullptr); assert(__bst::rdrs == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<BroadcastStreamT<limit_>>;
+#else
+	using Ptr = BroadcastStreamT<limit_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : BroadcastStreamT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored bytes)
+ *
+ * Return            : std::unique_pointer / pointer to BroadcastStreamT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto bst = new BroadcastStreamT<limit_>();
+		if (bst != nullptr)
+			bst->__bst::obj.res = bst;
+		return Ptr(bst);
+	}
+
+	void   reset    ( void )                                            {        bst_reset    (this); }
+	void   kill     ( void )                                            {        bst_kill     (this); }
+	void   destroy  ( void )                                            {        bst_destroy  (this); }
+	int    give     ( const void *_data, size_t _size )                 { return bst_give     (this, _data, _size); }
+	int    giveISR  ( const void *_data, size_t _size )                 { return bst_giveISR  (this, _data, _size); }
+	template<typename T>
+	int    sendFor  ( const void *_data, size_t _size, const T _delay ) { return bst_sendFor  (this, _data, _size, Clock::count(_delay)); }
+	template<typename T>
+	int    sendUntil( const void *_data, size_t _size, const T _time )  { return bst_sendUntil(this, _data, _size, Clock::until(_time)); }
+	int    send     ( const void *_data, size_t _size )                 { return bst_send     (this, _data, _size); }
+	size_t space    ( void )                                            { return bst_space    (this); }
+	size_t spaceISR ( void )                                            { return bst_spaceISR (this); }
+	size_t limit    ( void )                                            { return bst_limit    (this); }
+	size_t limitISR ( void )                                            { return bst_limitISR (this); }
+
+	private:
+	char data_[limit_];
+};
+
+/******************************************************************************
+ *
+ * Class             : BroadcastReader
+ *
+ * Description       : create and initialize a broadcast stream reader object
+ *
+ * Constructor parameters
+ *   mode            : overrun policy
+ *
+ ******************************************************************************/
+
+struct BroadcastReader : public __rdr
+{
+	constexpr
+	BroadcastReader( const unsigned _mode = rdrDrop ): __rdr _RDR_INIT(_mode) {}
+
+	BroadcastReader( BroadcastReader&& ) = default;
+	BroadcastReader( const BroadcastReader& ) = delete;
+	BroadcastReader& operator=( BroadcastReader&& ) = delete;
+	BroadcastReader& operator=( const BroadcastReader& ) = delete;
+
+	~BroadcastReader( void ) { assert(__rdr::obj.queue == nullptr); assert(__rdr::bst == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<BroadcastReader>;
+#else
+	using Ptr = BroadcastReader *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : BroadcastReader::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   mode            : overrun policy
+ *
+ * Return            : std::unique_pointer / pointer to BroadcastReader object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( const unsigned _mode = rdrDrop )
+	{
+		auto rdr = new BroadcastReader(_mode);
+		if (rdr != nullptr)
+			rdr->__rdr::obj.res = rdr;
+		return Ptr(rdr);
+	}
+
+	void   reset     ( void )                                                    {        rdr_reset     (this); }
+	void   kill      ( void )                                                    {        rdr_kill      (this); }
+	void   destroy   ( void )                                                    {        rdr_destroy   (this); }
+	int    attach    ( __bst *_bst )                                             { return rdr_attach    (this, _bst); }
+	void   detach    ( void )                                                    {        rdr_detach    (this); }
+	int    take      ( void *_data, size_t _size, size_t *_read = nullptr )      { return rdr_take      (this, _data, _size, _read); }
+	int    tryWait   ( void *_data, size_t _size, size_t *_read = nullptr )      { return rdr_tryWait   (this, _data, _size, _read); }
+	int    takeISR   ( void *_data, size_t _size, size_t *_read = nullptr )      { return rdr_takeISR   (this, _data, _size, _read); }
+	template<typename T>
+	int    waitFor   ( void *_data, size_t _size, size_t *_read, const T _delay ) { return rdr_waitFor  (this, _data, _size, _read, Clock::count(_delay)); }
+	template<typename T>
+	int    waitUntil ( void *_data, size_t _size, size_t *_read, const T _time )  { return rdr_waitUntil(this, _data, _size, _read, Clock::until(_time)); }
+	int    wait      ( void *_data, size_t _size, size_t *_read = nullptr )      { return rdr_wait      (this, _data, _size, _read); }
+	const
+	void * peek      ( size_t *_size )                                           { return rdr_peek      (this, _size); }
+	const
+	void * peekISR   ( size_t *_size )                                           { return rdr_peekISR   (this, _size); }
+	void   consume   ( size_t  _size )                                           {        rdr_consume   (this, _size); }
+	void   consumeISR( size_t  _size )                                           {        rdr_consumeISR(this, _size); }
+	size_t count     ( void )                                                    { return rdr_count     (this); }
+	size_t countISR  ( void )                                                    { return rdr_countISR  (this); }
+	size_t lost      ( void )                                                    { return rdr_lost      (this); }
+	size_t lostISR   ( void )                                                    { return rdr_lostISR   (this); }
+};
+
+}     //  namespace
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_BST_H
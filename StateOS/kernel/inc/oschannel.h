@@ -0,0 +1,893 @@
+/******************************************************************************
+
+    @file    StateOS: oschannel.h
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_CHN_H
+#define __STATEOS_CHN_H
+
+#include "oskernel.h"
+#include "osclock.h"
+
+/******************************************************************************
+ *
+ * Name              : channel
+ *
+ ******************************************************************************/
+
+typedef struct __chn chn_t, * const chn_id;
+
+struct __chn
+{
+	obj_t    obj;   // object header
+
+	unsigned count; // number of elements in the channel buffer
+	unsigned limit; // size of the channel buffer (max number of elements)
+	size_t   size;  // size of a single element (in bytes)
+
+	unsigned head;  // first element to read from data buffer
+	unsigned tail;  // first element to write into data buffer
+	char *   data;  // data buffer
+
+	void  (* init)( void *dst, void *src ); // move-construct an element (NULL: memcpy)
+	void  (* move)( void *dst, void *src ); // move-assign an element (NULL: memcpy)
+	void  (* drop)( void *obj );            // destroy an element (NULL: nothing)
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _CHN_INIT
+ *
+ * Description       : create and initialize a channel object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of elements)
+ *   size            : size of a single element (in bytes)
+ *   data            : channel data buffer
+ *   init            : function move-constructing an element (NULL: memcpy)
+ *   move            : function move-assigning an element (NULL: memcpy)
+ *   drop            : function destroying an element (NULL: nothing)
+ *
+ * Return            : channel object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _CHN_INIT( _limit, _size, _data, _init, _move, _drop ) { _OBJ_INIT(), 0, _limit, _size, 0, 0, _data, _init, _move, _drop }
+
+/******************************************************************************
+ *
+ * Name              : _CHN_DATA
+ *
+ * Description       : create a channel data buffer
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of elements)
+ *   size            : size of a single element (in bytes)
+ *
+ * Return            : channel data buffer
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _CHN_DATA( _limit, _size ) (char[_limit * _size]){ 0 }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : OS_CHN
+ *
+ * Description       : define and initialize a channel object
+ *
+ * Parameters
+ *   chn             : name of a pointer to channel object
+ *   limit           : size of a buffer (max number of elements)
+ *   size            : size of a single element (in bytes)
+ *
+ ******************************************************************************/
+
+#define             OS_CHN( chn, limit, size )                                                \
+                       char chn##__buf[limit * size];                                          \
+                       chn_t chn##__chn = _CHN_INIT( limit, size, chn##__buf, NULL, NULL, NULL ); \
+                       chn_id chn = & chn##__chn
+
+/******************************************************************************
+ *
+ * Name              : static_CHN
+ *
+ * Description       : define and initialize a static channel object
+ *
+ * Parameters
+ *   chn             : name of a pointer to channel object
+ *   limit           : size of a buffer (max number of elements)
+ *   size            : size of a single element (in bytes)
+ *
+ ******************************************************************************/
+
+#define         static_CHN( chn, limit, size )                                                \
+                static char chn##__buf[limit * size];                                          \
+                static chn_t chn##__chn = _CHN_INIT( limit, size, chn##__buf, NULL, NULL, NULL ); \
+                static chn_id chn = & chn##__chn
+
+/******************************************************************************
+ *
+ * Name              : CHN_INIT
+ *
+ * Description       : create and initialize a channel object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of elements)
+ *   size            : size of a single element (in bytes)
+ *
+ * Return            : channel object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                CHN_INIT( limit, size ) \
+                      _CHN_INIT( limit, size, _CHN_DATA( limit, size ), NULL, NULL, NULL )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : CHN_CREATE
+ * Alias             : CHN_NEW
+ *
+ * Description       : create and initialize a channel object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of elements)
+ *   size            : size of a single element (in bytes)
+ *
+ * Return            : pointer to channel object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                CHN_CREATE( limit, size ) \
+           (chn_t[]) { CHN_INIT  ( limit, size ) }
+#define                CHN_NEW \
+                       CHN_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : chn_init
+ *
+ * Description       : initialize a channel object
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   size            : size of a single element (in bytes)
+ *   data            : channel data buffer
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     elements are transferred with memcpy
+ *
+ ******************************************************************************/
+
+void chn_init( chn_t *chn, size_t size, void *data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : chn_create
+ * Alias             : chn_new
+ *
+ * Description       : create and initialize a new channel object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of elements)
+ *   size            : size of a single element (in bytes)
+ *
+ * Return            : pointer to channel object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *                     elements are transferred with memcpy
+ *
+ ******************************************************************************/
+
+chn_t *chn_create( unsigned limit, size_t size );
+
+__STATIC_INLINE
+chn_t *chn_new( unsigned limit, size_t size ) { return chn_create(limit, size); }
+
+/******************************************************************************
+ *
+ * Name              : chn_reset
+ * Alias             : chn_kill
+ *
+ * Description       : reset the channel object, destroy all stored elements
+ *                     and wake up all waiting tasks with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void chn_reset( chn_t *chn );
+
+__STATIC_INLINE
+void chn_kill( chn_t *chn ) { chn_reset(chn); }
+
+/******************************************************************************
+ *
+ * Name              : chn_destroy
+ * Alias             : chn_delete
+ *
+ * Description       : reset the channel object, destroy all stored elements,
+ *                     wake up all waiting tasks with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void chn_destroy( chn_t *chn );
+
+__STATIC_INLINE
+void chn_delete( chn_t *chn ) { chn_destroy(chn); }
+
+/******************************************************************************
+ *
+ * Name              : chn_take
+ * Alias             : chn_tryWait
+ * ISR alias         : chn_takeISR
+ *
+ * Description       : try to transfer an element from the channel object,
+ *                     don't wait if the channel object is empty
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the object receiving the element (move-assigned)
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully transferred from the channel object
+ *   E_TIMEOUT       : channel object is empty, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int chn_take( chn_t *chn, void *data );
+
+__STATIC_INLINE
+int chn_tryWait( chn_t *chn, void *data ) { return chn_take(chn, data); }
+
+__STATIC_INLINE
+int chn_takeISR( chn_t *chn, void *data ) { return chn_take(chn, data); }
+
+/******************************************************************************
+ *
+ * Name              : chn_waitFor
+ *
+ * Description       : try to transfer an element from the channel object,
+ *                     wait for given duration of time while the channel object is empty
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the object receiving the element (move-assigned)
+ *   delay           : duration of time (maximum number of ticks to wait while the channel object is empty)
+ *                     IMMEDIATE: don't wait if the channel object is empty
+ *                     INFINITE:  wait indefinitely while the channel object is empty
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully transferred from the channel object
+ *   E_STOPPED       : channel object was reseted before the specified timeout expired
+ *   E_DELETED       : channel object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : channel object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     a sender finding the waiting task moves its element directly into the object
+ *
+ ******************************************************************************/
+
+int chn_waitFor( chn_t *chn, void *data, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : chn_waitUntil
+ *
+ * Description       : try to transfer an element from the channel object,
+ *                     wait until given timepoint while the channel object is empty
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the object receiving the element (move-assigned)
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully transferred from the channel object
+ *   E_STOPPED       : channel object was reseted before the specified timeout expired
+ *   E_DELETED       : channel object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : channel object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     a sender finding the waiting task moves its element directly into the object
+ *
+ ******************************************************************************/
+
+int chn_waitUntil( chn_t *chn, void *data, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : chn_wait
+ *
+ * Description       : try to transfer an element from the channel object,
+ *                     wait indefinitely while the channel object is empty
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the object receiving the element (move-assigned)
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully transferred from the channel object
+ *   E_STOPPED       : channel object was reseted
+ *   E_DELETED       : channel object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     a sender finding the waiting task moves its element directly into the object
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int chn_wait( chn_t *chn, void *data ) { return chn_waitFor(chn, data, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : chn_give
+ * ISR alias         : chn_giveISR
+ *
+ * Description       : try to transfer an element to the channel object,
+ *                     don't wait if the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the element (moved from)
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully transferred to the channel object
+ *   E_TIMEOUT       : channel object is full, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     if a task is waiting for an element, the element is moved directly to the task
+ *
+ ******************************************************************************/
+
+int chn_give( chn_t *chn, void *data );
+
+__STATIC_INLINE
+int chn_giveISR( chn_t *chn, void *data ) { return chn_give(chn, data); }
+
+/******************************************************************************
+ *
+ * Name              : chn_sendFor
+ *
+ * Description       : try to transfer an element to the channel object,
+ *                     wait for given duration of time while the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the element (moved from)
+ *   delay           : duration of time (maximum number of ticks to wait while the channel object is full)
+ *                     IMMEDIATE: don't wait if the channel object is full
+ *                     INFINITE:  wait indefinitely while the channel object is full
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully transferred to the channel object
+ *   E_STOPPED       : channel object was reseted before the specified timeout expired
+ *   E_DELETED       : channel object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : channel object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     if a task is waiting for an element, the element is moved directly to the task
+ *
+ ******************************************************************************/
+
+int chn_sendFor( chn_t *chn, void *data, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : chn_sendUntil
+ *
+ * Description       : try to transfer an element to the channel object,
+ *                     wait until given timepoint while the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the element (moved from)
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully transferred to the channel object
+ *   E_STOPPED       : channel object was reseted before the specified timeout expired
+ *   E_DELETED       : channel object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : channel object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     if a task is waiting for an element, the element is moved directly to the task
+ *
+ ******************************************************************************/
+
+int chn_sendUntil( chn_t *chn, void *data, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : chn_send
+ *
+ * Description       : try to transfer an element to the channel object,
+ *                     wait indefinitely while the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   data            : pointer to the element (moved from)
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully transferred to the channel object
+ *   E_STOPPED       : channel object was reseted
+ *   E_DELETED       : channel object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     if a task is waiting for an element, the element is moved directly to the task
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int chn_send( chn_t *chn, void *data ) { return chn_sendFor(chn, data, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : chn_emplace
+ * ISR alias         : chn_emplaceISR
+ *
+ * Description       : try to construct a new element in the channel object,
+ *                     don't wait if the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   fun             : function constructing the element at 'dst' from 'arg'
+ *   arg             : argument of the function
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully constructed in the channel object
+ *   E_TIMEOUT       : channel object is full, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the function is called inside the critical section
+ *
+ ******************************************************************************/
+
+int chn_emplace( chn_t *chn, void (*fun)( void *dst, void *arg ), void *arg );
+
+__STATIC_INLINE
+int chn_emplaceISR( chn_t *chn, void (*fun)( void *dst, void *arg ), void *arg ) { return chn_emplace(chn, fun, arg); }
+
+/******************************************************************************
+ *
+ * Name              : chn_emplaceFor
+ *
+ * Description       : try to construct a new element in the channel object,
+ *                     wait for given duration of time while the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   fun             : function constructing the element at 'dst' from 'arg'
+ *   arg             : argument of the function
+ *   delay           : duration of time (maximum number of ticks to wait while the channel object is full)
+ *                     IMMEDIATE: don't wait if the channel object is full
+ *                     INFINITE:  wait indefinitely while the channel object is full
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully constructed in the channel object
+ *   E_STOPPED       : channel object was reseted before the specified timeout expired
+ *   E_DELETED       : channel object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : channel object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the function is called inside the critical section
+ *
+ ******************************************************************************/
+
+int chn_emplaceFor( chn_t *chn, void (*fun)( void *dst, void *arg ), void *arg, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : chn_emplaceUntil
+ *
+ * Description       : try to construct a new element in the channel object,
+ *                     wait until given timepoint while the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   fun             : function constructing the element at 'dst' from 'arg'
+ *   arg             : argument of the function
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully constructed in the channel object
+ *   E_STOPPED       : channel object was reseted before the specified timeout expired
+ *   E_DELETED       : channel object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : channel object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the function is called inside the critical section
+ *
+ ******************************************************************************/
+
+int chn_emplaceUntil( chn_t *chn, void (*fun)( void *dst, void *arg ), void *arg, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : chn_emplaceWait
+ *
+ * Description       : try to construct a new element in the channel object,
+ *                     wait indefinitely while the channel object is full
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *   fun             : function constructing the element at 'dst' from 'arg'
+ *   arg             : argument of the function
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully constructed in the channel object
+ *   E_STOPPED       : channel object was reseted
+ *   E_DELETED       : channel object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     the function is called inside the critical section
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int chn_emplaceWait( chn_t *chn, void (*fun)( void *dst, void *arg ), void *arg ) { return chn_emplaceFor(chn, fun, arg, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : chn_count
+ * ISR alias         : chn_countISR
+ *
+ * Description       : return the number of elements in the channel object
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : number of elements in the channel object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned chn_count( chn_t *chn );
+
+__STATIC_INLINE
+unsigned chn_countISR( chn_t *chn ) { return chn_count(chn); }
+
+/******************************************************************************
+ *
+ * Name              : chn_space
+ * ISR alias         : chn_spaceISR
+ *
+ * Description       : return the number of free slots in the channel object
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : number of free slots in the channel object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned chn_space( chn_t *chn );
+
+__STATIC_INLINE
+unsigned chn_spaceISR( chn_t *chn ) { return chn_space(chn); }
+
+/******************************************************************************
+ *
+ * Name              : chn_limit
+ * ISR alias         : chn_limitISR
+ *
+ * Description       : return the size of the channel object (max number of elements)
+ *
+ * Parameters
+ *   chn             : pointer to channel object
+ *
+ * Return            : size of the channel object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned chn_limit( chn_t *chn );
+
+__STATIC_INLINE
+unsigned chn_limitISR( chn_t *chn ) { return chn_limit(chn); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+#include <new>
+#include <utility>
+namespace stateos {
+
+/******************************************************************************
+ *
+ * Class             : Channel<>
+ *
+ * Description       : create and initialize a channel object transferring objects of class T,
+ *                     elements are stored in place and transferred with move semantics
+ *
+ * Constructor parameters
+ *   T               : class of a single element
+ *   limit           : size of a buffer (max number of elements)
+ *
+ * Note              : move constructor, move assignment and destructor of T are called inside the critical section
+ *
+ ******************************************************************************/
+
+template<class T, unsigned limit_>
+struct Channel : public __chn
+{
+	constexpr
+	Channel( void ): __chn _CHN_INIT(limit_, sizeof(T), data_, init_, move_, drop_) {}
+
+	Channel( Channel&& ) = delete;
+	Channel( const Channel& ) = delete;
+	Channel& operator=( Channel&& ) = delete;
+	Channel& operator=( const Channel& ) = delete;
+
+	~Channel( void ) { assert(__chn::obj.queue == nullptr); chn_reset(this); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<Channel<T, limit_>>;
+#else
+	using Ptr = Channel<T, limit_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : Channel<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   T               : class of a single element
+ *   limit           : size of a buffer (max number of elements)
+ *
+ * Return            : std::unique_pointer / pointer to Channel<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto chn = new Channel<T, limit_>();
+		if (chn != nullptr)
+			chn->__chn::obj.res = chn;
+		return Ptr(chn);
+	}
+
+	void     reset    ( void )                         {        chn_reset    (this); }
+	void     kill     ( void )                         {        chn_kill     (this); }
+	void     destroy  ( void )                         {        chn_destroy  (this); }
+	int      take     (       T &_data )               { return chn_take     (this, &_data); }
+	int      tryWait  (       T &_data )               { return chn_tryWait  (this, &_data); }
+	int      takeISR  (       T &_data )               { return chn_takeISR  (this, &_data); }
+	template<typename D>
+	int      waitFor  (       T &_data, const D _delay ){ return chn_waitFor  (this, &_data, Clock::count(_delay)); }
+	template<typename D>
+	int      waitUntil(       T &_data, const D _time ) { return chn_waitUntil(this, &_data, Clock::until(_time)); }
+	int      wait     (       T &_data )               { return chn_wait     (this, &_data); }
+	int      give     (       T&&_data )               { return chn_give     (this, &_data); }
+	int      giveISR  (       T&&_data )               { return chn_giveISR  (this, &_data); }
+	template<typename D>
+	int      sendFor  (       T&&_data, const D _delay ){ return chn_sendFor  (this, &_data, Clock::count(_delay)); }
+	template<typename D>
+	int      sendUntil(       T&&_data, const D _time ) { return chn_sendUntil(this, &_data, Clock::until(_time)); }
+	int      send     (       T&&_data )               { return chn_send     (this, &_data); }
+	int      give     ( const T &_data )               { T tmp(_data); return give(std::move(tmp)); }
+	int      giveISR  ( const T &_data )               { T tmp(_data); return giveISR(std::move(tmp)); }
+	template<typename D>
+	int      sendFor  ( const T &_data, const D _delay ){ T tmp(_data); return sendFor(std::move(tmp), _delay); }
+	template<typename D>
+	int      sendUntil( const T &_data, const D _time ) { T tmp(_data); return sendUntil(std::move(tmp), _time); }
+	int      send     ( const T &_data )               { T tmp(_data); return send(std::move(tmp)); }
+	unsigned count    ( void )                         { return chn_count    (this); }
+	unsigned countISR ( void )                         { return chn_countISR (this); }
+	unsigned space    ( void )                         { return chn_space    (this); }
+	unsigned spaceISR ( void )                         { return chn_spaceISR (this); }
+	unsigned limit    ( void )                         { return chn_limit    (this); }
+	unsigned limitISR ( void )                         { return chn_limitISR (this); }
+
+/******************************************************************************
+ *
+ * Name              : Channel<>::emplace
+ * ISR alias         : Channel<>::emplaceISR
+ *
+ * Description       : try to construct a new element in place in the channel object,
+ *                     don't wait if the channel object is full
+ *
+ * Parameters
+ *   args            : arguments of the constructor of the element
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully constructed in the channel object
+ *   E_TIMEOUT       : channel object is full, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+	template<class... Args>
+	int emplace( Args&&... _args )
+	{
+		auto fun = [&]( void *dst ){ new (dst) T(std::forward<Args>(_args)...); };
+		return chn_emplace(this, make_<decltype(fun)>, &fun);
+	}
+
+	template<class... Args>
+	int emplaceISR( Args&&... _args ) { return emplace(std::forward<Args>(_args)...); }
+
+/******************************************************************************
+ *
+ * Name              : Channel<>::emplaceFor
+ *
+ * Description       : try to construct a new element in place in the channel object,
+ *                     wait for given duration of time while the channel object is full
+ *
+ * Parameters
+ *   delay           : duration of time (maximum number of ticks to wait while the channel object is full)
+ *                     IMMEDIATE: don't wait if the channel object is full
+ *                     INFINITE:  wait indefinitely while the channel object is full
+ *   args            : arguments of the constructor of the element
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully constructed in the channel object
+ *   E_STOPPED       : channel object was reseted before the specified timeout expired
+ *   E_DELETED       : channel object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : channel object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	template<typename D, class... Args>
+	int emplaceFor( const D _delay, Args&&... _args )
+	{
+		auto fun = [&]( void *dst ){ new (dst) T(std::forward<Args>(_args)...); };
+		return chn_emplaceFor(this, make_<decltype(fun)>, &fun, Clock::count(_delay));
+	}
+
+/******************************************************************************
+ *
+ * Name              : Channel<>::emplaceUntil
+ *
+ * Description       : try to construct a new element in place in the channel object,
+ *                     wait until given timepoint while the channel object is full
+ *
+ * Parameters
+ *   time            : timepoint value
+ *   args            : arguments of the constructor of the element
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully constructed in the channel object
+ *   E_STOPPED       : channel object was reseted before the specified timeout expired
+ *   E_DELETED       : channel object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : channel object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	template<typename D, class... Args>
+	int emplaceUntil( const D _time, Args&&... _args )
+	{
+		auto fun = [&]( void *dst ){ new (dst) T(std::forward<Args>(_args)...); };
+		return chn_emplaceUntil(this, make_<decltype(fun)>, &fun, Clock::until(_time));
+	}
+
+/******************************************************************************
+ *
+ * Name              : Channel<>::emplaceWait
+ *
+ * Description       : try to construct a new element in place in the channel object,
+ *                     wait indefinitely while the channel object is full
+ *
+ * Parameters
+ *   args            : arguments of the constructor of the element
+ *
+ * Return
+ *   E_SUCCESS       : the element was successfully constructed in the channel object
+ *   E_STOPPED       : channel object was reseted
+ *   E_DELETED       : channel object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	template<class... Args>
+	int emplaceWait( Args&&... _args )
+	{
+		auto fun = [&]( void *dst ){ new (dst) T(std::forward<Args>(_args)...); };
+		return chn_emplaceWait(this, make_<decltype(fun)>, &fun);
+	}
+
+	private:
+	static void init_( void *dst, void *src ) { new (dst) T(std::move(*static_cast<T *>(src))); }
+	static void move_( void *dst, void *src ) { *static_cast<T *>(dst) = std::move(*static_cast<T *>(src)); }
+	static void drop_( void *obj )            { static_cast<T *>(obj)->~T(); }
+	template<class F>
+	static void make_( void *dst, void *arg ) { (*static_cast<F *>(arg))(dst); }
+
+	alignas(T) char data_[limit_ * sizeof(T)];
+};
+
+}     //  namespace
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_CHN_H
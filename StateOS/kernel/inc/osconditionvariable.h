@@ -322,13 +322,21 @@ int cnd_wait( cnd_t *cnd, mtx_t *mtx ) { return cnd_waitFor(cnd, mtx, INFINITE);
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     signalled tasks are moved directly to the queue of the locked mutex,
+ *                     or get the mutex if it is free, so they are not woken up only to block again
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue,
+ *                     the request is dropped if the deferred services queue is full (see sys_deferOverflow)
  *
  ******************************************************************************/
 
 void cnd_give( cnd_t *cnd, bool all );
 
+#if OS_DEFER_SIZE
+void cnd_giveISR( cnd_t *cnd, bool all );
+#else
 __STATIC_INLINE
 void cnd_giveISR( cnd_t *cnd, bool all ) { cnd_give(cnd, all); }
+#endif
 
 /******************************************************************************
  *
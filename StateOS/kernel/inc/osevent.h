@@ -304,13 +304,19 @@ int evt_wait( evt_t *evt, unsigned *event ) { return evt_waitFor(evt, event, INF
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue,
+ *                     the request is dropped if the deferred services queue is full (see sys_deferOverflow)
  *
  ******************************************************************************/
 
 void evt_give( evt_t *evt, unsigned event );
 
+#if OS_DEFER_SIZE
+void evt_giveISR( evt_t *evt, unsigned event );
+#else
 __STATIC_INLINE
 void evt_giveISR( evt_t *evt, unsigned event ) { evt_give(evt, event); }
+#endif
 
 #ifdef __cplusplus
 }
@@ -391,13 +391,21 @@ int evq_waitAsync( evq_t *evq, unsigned *event );
  * Note              : can be used in both thread and handler mode
  *                     use ISR alias in blockable interrupt handlers
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue:
+ *                     E_SUCCESS means the request was queued, a full event queue object is never reported
+ *                     (the event value is dropped by the request if the event queue object is full then),
+ *                     E_TIMEOUT means the deferred services queue is full and the request was dropped
  *
  ******************************************************************************/
 
 int evq_give( evq_t *evq, unsigned event );
 
+#if OS_DEFER_SIZE
+int evq_giveISR( evq_t *evq, unsigned event );
+#else
 __STATIC_INLINE
 int evq_giveISR( evq_t *evq, unsigned event ) { return evq_give(evq, event); }
+#endif
 
 #if OS_ATOMICS
 int evq_giveAsync( evq_t *evq, unsigned event );
@@ -498,13 +506,71 @@ int evq_sendAsync( evq_t *evq, unsigned event );
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue,
+ *                     the request is dropped if the deferred services queue is full (see sys_deferOverflow)
  *
  ******************************************************************************/
 
 void evq_push( evq_t *evq, unsigned event );
 
+#if OS_DEFER_SIZE
+void evq_pushISR( evq_t *evq, unsigned event );
+#else
 __STATIC_INLINE
 void evq_pushISR( evq_t *evq, unsigned event ) { evq_push(evq, event); }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : evq_giveMany
+ * ISR alias         : evq_giveManyISR
+ *
+ * Description       : try to transfer as many events as possible (but not more than given number) to the event queue object,
+ *                     don't wait if the event queue object is full
+ *
+ * Parameters
+ *   evq             : pointer to event queue object
+ *   data            : pointer to the array of events
+ *   count           : max number of events to transfer
+ *
+ * Return            : number of events transferred to the event queue object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     all events are transferred in a single critical section
+ *
+ ******************************************************************************/
+
+unsigned evq_giveMany( evq_t *evq, const unsigned *data, unsigned count );
+
+__STATIC_INLINE
+unsigned evq_giveManyISR( evq_t *evq, const unsigned *data, unsigned count ) { return evq_giveMany(evq, data, count); }
+
+/******************************************************************************
+ *
+ * Name              : evq_takeMany
+ * ISR alias         : evq_takeManyISR
+ *
+ * Description       : try to transfer as many events as possible (but not more than given number) from the event queue object,
+ *                     don't wait if the event queue object is empty
+ *
+ * Parameters
+ *   evq             : pointer to event queue object
+ *   data            : pointer to the array to store events
+ *   count           : max number of events to transfer
+ *
+ * Return            : number of events transferred from the event queue object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     all events are transferred in a single critical section
+ *
+ ******************************************************************************/
+
+unsigned evq_takeMany( evq_t *evq, unsigned *data, unsigned count );
+
+__STATIC_INLINE
+unsigned evq_takeManyISR( evq_t *evq, unsigned *data, unsigned count ) { return evq_takeMany(evq, data, count); }
 
 /******************************************************************************
  *
@@ -655,6 +721,10 @@ struct EventQueueT : public __evq
 	int      send     ( unsigned  _event )                 { return evq_send     (this, _event); }
 	void     push     ( unsigned  _event )                 {        evq_push     (this, _event); }
 	void     pushISR  ( unsigned  _event )                 {        evq_pushISR  (this, _event); }
+	unsigned giveMany ( const unsigned *_data, unsigned _count ) { return evq_giveMany   (this, _data, _count); }
+	unsigned giveManyISR( const unsigned *_data, unsigned _count ) { return evq_giveManyISR(this, _data, _count); }
+	unsigned takeMany (       unsigned *_data, unsigned _count ) { return evq_takeMany   (this, _data, _count); }
+	unsigned takeManyISR(     unsigned *_data, unsigned _count ) { return evq_takeManyISR(this, _data, _count); }
 	unsigned count    ( void )                             { return evq_count    (this); }
 	unsigned countISR ( void )                             { return evq_countISR (this); }
 	unsigned space    ( void )                             { return evq_space    (this); }
@@ -0,0 +1,751 @@
+/******************************************************************************
+
+    @file    StateOS: osexecutor.h
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_EXE_H
+#define __STATEOS_EXE_H
+
+#include "oskernel.h"
+#include "osclock.h"
+#include "ostask.h"
+
+/******************************************************************************
+ *
+ * Name              : executor job
+ *
+ ******************************************************************************/
+
+// states of the executor job
+enum
+{
+	exjIdle = 0, // job was never given or was cancelled
+	exjQueued,   // job is waiting for a worker
+	exjRunning,  // job is being executed by a worker
+	exjDone,     // job procedure and completion callback have been executed
+};
+
+typedef struct __exj exj_t, * const exj_id;
+
+struct __exj
+{
+	obj_t    obj;   // object header (tasks waiting for completion of the job)
+
+	exj_t  * next;  // next job in the executor queue
+	struct __exe *
+	         exe;   // executor owning the job (queued or running)
+	void  (* fun)( void * );    // job procedure
+	void   * arg;   // argument of the job procedure
+	void  (* done)( exj_t * );  // completion callback (can be NULL)
+	unsigned prio;  // priority of the job
+	volatile
+	unsigned state; // state of the job
+};
+
+/******************************************************************************
+ *
+ * Name              : executor (worker pool)
+ *
+ ******************************************************************************/
+
+typedef struct __exe exe_t, * const exe_id;
+
+struct __exe
+{
+	obj_t    obj;   // object header (idle workers)
+
+	exj_t  * head;  // queue of pending jobs, ordered by job priority
+	exj_t  * busy;  // list of jobs being executed
+	unsigned count; // number of pending jobs
+	unsigned prio;  // priority of worker tasks
+	unsigned limit; // number of worker tasks
+	tsk_t  * workers; // array of worker tasks
+	stk_t  * stack; // base of the storage for stacks of worker tasks
+	size_t   size;  // size of the stack of worker task (in bytes)
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _EXJ_INIT
+ *
+ * Description       : create and initialize an executor job object
+ *
+ * Parameters
+ *   fun             : job procedure
+ *   arg             : argument of the job procedure
+ *   done            : completion callback (can be NULL)
+ *
+ * Return            : executor job object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _EXJ_INIT( _fun, _arg, _done ) { _OBJ_INIT(), NULL, NULL, _fun, _arg, _done, 0, exjIdle }
+
+/******************************************************************************
+ *
+ * Name              : OS_EXJ
+ *
+ * Description       : define and initialize an executor job object
+ *
+ * Parameters
+ *   job             : name of a pointer to executor job object
+ *   fun             : job procedure
+ *   arg             : argument of the job procedure
+ *   done            : completion callback (can be NULL)
+ *
+ ******************************************************************************/
+
+#define             OS_EXJ( job, fun, arg, done )                     \
+                       exj_t job##__exj = _EXJ_INIT( fun, arg, done ); \
+                       exj_id job = & job##__exj
+
+/******************************************************************************
+ *
+ * Name              : static_EXJ
+ *
+ * Description       : define and initialize a static executor job object
+ *
+ * Parameters
+ *   job             : name of a pointer to executor job object
+ *   fun             : job procedure
+ *   arg             : argument of the job procedure
+ *   done            : completion callback (can be NULL)
+ *
+ ******************************************************************************/
+
+#define         static_EXJ( job, fun, arg, done )                     \
+                static exj_t job##__exj = _EXJ_INIT( fun, arg, done ); \
+                static exj_id job = & job##__exj
+
+/******************************************************************************
+ *
+ * Name              : EXJ_INIT
+ *
+ * Description       : create and initialize an executor job object
+ *
+ * Parameters
+ *   fun             : job procedure
+ *   arg             : argument of the job procedure
+ *   done            : completion callback (can be NULL)
+ *
+ * Return            : executor job object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                EXJ_INIT( fun, arg, done ) \
+                      _EXJ_INIT( fun, arg, done )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : EXJ_CREATE
+ * Alias             : EXJ_NEW
+ *
+ * Description       : create and initialize an executor job object
+ *
+ * Parameters
+ *   fun             : job procedure
+ *   arg             : argument of the job procedure
+ *   done            : completion callback (can be NULL)
+ *
+ * Return            : pointer to executor job object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                EXJ_CREATE( fun, arg, done ) \
+           (exj_t[]) { EXJ_INIT  ( fun, arg, done ) }
+#define                EXJ_NEW \
+                       EXJ_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : exj_init
+ *
+ * Description       : initialize an executor job object
+ *
+ * Parameters
+ *   job             : pointer to executor job object
+ *   fun             : job procedure
+ *   arg             : argument of the job procedure
+ *   done            : completion callback (can be NULL)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     the job must not be queued or running
+ *
+ ******************************************************************************/
+
+void exj_init( exj_t *job, void (*fun)( void * ), void *arg, void (*done)( exj_t * ) );
+
+/******************************************************************************
+ *
+ * Name              : exj_take
+ * Alias             : exj_tryWait
+ * ISR alias         : exj_takeISR
+ *
+ * Description       : check if the job is completed,
+ *                     don't wait if the job is queued or running
+ *
+ * Parameters
+ *   job             : pointer to executor job object
+ *
+ * Return
+ *   E_SUCCESS       : the job is not queued nor running
+ *   E_TIMEOUT       : the job is queued or running, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int exj_take( exj_t *job );
+
+__STATIC_INLINE
+int exj_tryWait( exj_t *job ) { return exj_take(job); }
+
+__STATIC_INLINE
+int exj_takeISR( exj_t *job ) { return exj_take(job); }
+
+/******************************************************************************
+ *
+ * Name              : exj_waitFor
+ *
+ * Description       : wait for given duration of time for completion of the job
+ *
+ * Parameters
+ *   job             : pointer to executor job object
+ *   delay           : duration of time (maximum number of ticks to wait for completion of the job)
+ *                     IMMEDIATE: don't wait for completion of the job
+ *                     INFINITE:  wait indefinitely for completion of the job
+ *
+ * Return
+ *   E_SUCCESS       : the job was completed (or is not queued nor running)
+ *   E_STOPPED       : the job was cancelled or its executor was reseted before the specified timeout expired
+ *   E_DELETED       : executor of the job was deleted before the specified timeout expired
+ *   E_TIMEOUT       : the job was not completed before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int exj_waitFor( exj_t *job, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : exj_waitUntil
+ *
+ * Description       : wait until given timepoint for completion of the job
+ *
+ * Parameters
+ *   job             : pointer to executor job object
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the job was completed (or is not queued nor running)
+ *   E_STOPPED       : the job was cancelled or its executor was reseted before the specified timeout expired
+ *   E_DELETED       : executor of the job was deleted before the specified timeout expired
+ *   E_TIMEOUT       : the job was not completed before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int exj_waitUntil( exj_t *job, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : exj_wait
+ *
+ * Description       : wait indefinitely for completion of the job
+ *
+ * Parameters
+ *   job             : pointer to executor job object
+ *
+ * Return
+ *   E_SUCCESS       : the job was completed (or is not queued nor running)
+ *   E_STOPPED       : the job was cancelled or its executor was reseted
+ *   E_DELETED       : executor of the job was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int exj_wait( exj_t *job ) { return exj_waitFor(job, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : _EXE_INIT
+ *
+ * Description       : create and initialize an executor object
+ *
+ * Parameters
+ *   prio            : priority of worker tasks
+ *   limit           : number of worker tasks
+ *   workers         : array of worker tasks
+ *   stack           : base of the storage for stacks of worker tasks
+ *   size            : size of the stack of worker task (in bytes)
+ *
+ * Return            : executor object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _EXE_INIT( _prio, _limit, _workers, _stack, _size ) \
+                       { _OBJ_INIT(), NULL, NULL, 0, _prio, _limit, _workers, _stack, _size }
+
+/******************************************************************************
+ *
+ * Name              : OS_EXE
+ *
+ * Description       : define and initialize an executor object
+ *
+ * Parameters
+ *   exe             : name of a pointer to executor object
+ *   limit           : number of worker tasks
+ *   prio            : priority of worker tasks
+ *   size            : (optional) size of the stack of worker task (in bytes); default: OS_STACK_SIZE
+ *
+ * Note              : worker tasks must be started with exe_start
+ *
+ ******************************************************************************/
+
+#define             OS_EXE( exe, limit, prio, ... )                                                                \
+                       tsk_t exe##__wrk[limit];                                                                     \
+                       stk_t exe##__stk[limit][STK_SIZE( _VA_STK(__VA_ARGS__) )] __STKALIGN;                        \
+                       exe_t exe##__exe = _EXE_INIT( prio, limit, exe##__wrk, exe##__stk[0], STK_OVER( _VA_STK(__VA_ARGS__) ) ); \
+                       exe_id exe = & exe##__exe
+
+/******************************************************************************
+ *
+ * Name              : static_EXE
+ *
+ * Description       : define and initialize a static executor object
+ *
+ * Parameters
+ *   exe             : name of a pointer to executor object
+ *   limit           : number of worker tasks
+ *   prio            : priority of worker tasks
+ *   size            : (optional) size of the stack of worker task (in bytes); default: OS_STACK_SIZE
+ *
+ * Note              : worker tasks must be started with exe_start
+ *
+ ******************************************************************************/
+
+#define         static_EXE( exe, limit, prio, ... )                                                                \
+                static tsk_t exe##__wrk[limit];                                                                     \
+                static stk_t exe##__stk[limit][STK_SIZE( _VA_STK(__VA_ARGS__) )] __STKALIGN;                        \
+                static exe_t exe##__exe = _EXE_INIT( prio, limit, exe##__wrk, exe##__stk[0], STK_OVER( _VA_STK(__VA_ARGS__) ) ); \
+                static exe_id exe = & exe##__exe
+
+/******************************************************************************
+ *
+ * Name              : exe_init
+ *
+ * Description       : initialize an executor object
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *   prio            : priority of worker tasks
+ *   workers         : array of worker tasks
+ *   limit           : number of worker tasks
+ *   stack           : base of the storage for stacks of worker tasks (limit * STK_SIZE(size) elements)
+ *   size            : size of the stack of worker task (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     worker tasks must be started with exe_start
+ *
+ ******************************************************************************/
+
+void exe_init( exe_t *exe, unsigned prio, tsk_t *workers, unsigned limit, stk_t *stack, size_t size );
+
+/******************************************************************************
+ *
+ * Name              : exe_create
+ * Alias             : exe_new
+ *
+ * Description       : create and initialize a new executor object and start its worker tasks
+ *
+ * Parameters
+ *   limit           : number of worker tasks
+ *   prio            : priority of worker tasks
+ *   size            : size of the stack of worker task (in bytes)
+ *
+ * Return            : pointer to executor object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+exe_t *exe_create( unsigned limit, unsigned prio, size_t size );
+
+__STATIC_INLINE
+exe_t *exe_new( unsigned limit, unsigned prio, size_t size ) { return exe_create(limit, prio, size); }
+
+/******************************************************************************
+ *
+ * Name              : exe_start
+ *
+ * Description       : start all inactive worker tasks of the executor
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void exe_start( exe_t *exe );
+
+/******************************************************************************
+ *
+ * Name              : exe_reset
+ * Alias             : exe_kill
+ *
+ * Description       : stop all worker tasks, cancel all queued and running jobs
+ *                     and wake up all tasks waiting for these jobs with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     cannot be called from a worker task of the executor
+ *
+ ******************************************************************************/
+
+void exe_reset( exe_t *exe );
+
+__STATIC_INLINE
+void exe_kill( exe_t *exe ) { exe_reset(exe); }
+
+/******************************************************************************
+ *
+ * Name              : exe_destroy
+ * Alias             : exe_delete
+ *
+ * Description       : stop all worker tasks, cancel all queued and running jobs,
+ *                     wake up all tasks waiting for these jobs with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     cannot be called from a worker task of the executor
+ *
+ ******************************************************************************/
+
+void exe_destroy( exe_t *exe );
+
+__STATIC_INLINE
+void exe_delete( exe_t *exe ) { exe_destroy(exe); }
+
+/******************************************************************************
+ *
+ * Name              : exe_give
+ * ISR alias         : exe_giveISR
+ *
+ * Description       : transfer the job to the executor,
+ *                     the job is executed by the first idle worker task,
+ *                     jobs with higher priority are executed first, in fifo order within the same priority
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *   job             : pointer to executor job object
+ *   prio            : priority of the job
+ *
+ * Return
+ *   E_SUCCESS       : the job was successfully transferred to the executor
+ *   E_FAILURE       : the job is already queued or running
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the job procedure is called with the job argument,
+ *                     then the completion callback (if any) is called with the job
+ *                     and finally tasks waiting for the job are woken up
+ *
+ ******************************************************************************/
+
+int exe_give( exe_t *exe, exj_t *job, unsigned prio );
+
+__STATIC_INLINE
+int exe_giveISR( exe_t *exe, exj_t *job, unsigned prio ) { return exe_give(exe, job, prio); }
+
+/******************************************************************************
+ *
+ * Name              : exe_cancel
+ * ISR alias         : exe_cancelISR
+ *
+ * Description       : remove the queued job from the executor
+ *                     and wake up all tasks waiting for the job with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *   job             : pointer to executor job object
+ *
+ * Return
+ *   E_SUCCESS       : the job was successfully removed from the executor
+ *   E_FAILURE       : the job is not queued in the executor (it may be running already)
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int exe_cancel( exe_t *exe, exj_t *job );
+
+__STATIC_INLINE
+int exe_cancelISR( exe_t *exe, exj_t *job ) { return exe_cancel(exe, job); }
+
+/******************************************************************************
+ *
+ * Name              : exe_count
+ * ISR alias         : exe_countISR
+ *
+ * Description       : return the number of jobs waiting for a worker
+ *
+ * Parameters
+ *   exe             : pointer to executor object
+ *
+ * Return            : number of queued jobs
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned exe_count( exe_t *exe );
+
+__STATIC_INLINE
+unsigned exe_countISR( exe_t *exe ) { return exe_count(exe); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+namespace stateos {
+
+#if __cplusplus >= 201402
+
+/******************************************************************************
+ *
+ * Class             : ExecutorJobT<>
+ *
+ * Description       : create and initialize an executor job object
+ *                     with storage for the job procedure (callable object) inside the object
+ *
+ * Constructor parameters
+ *   size            : size of the storage for the job procedure (in bytes)
+ *   fun             : (optional) job procedure (callable object without parameters)
+ *
+ * Note              : the callable object is stored inside the job object, no dynamic memory is used
+ *                     available for c++14 or later
+ *
+ ******************************************************************************/
+
+template<size_t size_ = 2 * sizeof(void *)>
+struct ExecutorJobT : public __exj
+{
+	ExecutorJobT( void ): __exj _EXJ_INIT(nullptr, nullptr, nullptr), drop_{nullptr} {}
+
+	template<class F>
+	ExecutorJobT( F&& _fun ): ExecutorJobT<size_>() { assign(std::forward<F>(_fun)); }
+
+	ExecutorJobT( ExecutorJobT&& ) = delete;
+	ExecutorJobT( const ExecutorJobT& ) = delete;
+	ExecutorJobT& operator=( ExecutorJobT&& ) = delete;
+	ExecutorJobT& operator=( const ExecutorJobT& ) = delete;
+
+	~ExecutorJobT( void ) { assert(__exj::obj.queue == nullptr); assert(__exj::exe == nullptr); clear_(); }
+
+/******************************************************************************
+ *
+ * Name              : ExecutorJobT<>::assign
+ *
+ * Description       : set the job procedure
+ *
+ * Parameters
+ *   fun             : job procedure (callable object without parameters)
+ *
+ * Return            : none
+ *
+ * Note              : the job must not be queued or running
+ *
+ ******************************************************************************/
+
+	template<class F>
+	void assign( F&& _fun )
+	{
+		using Fn = typename std::decay<F>::type;
+		static_assert(sizeof(Fn) <= size_, "callable object is too large for the job storage");
+		static_assert(alignof(Fn) <= alignof(std::max_align_t), "incorrect alignment of the callable object");
+		assert(__exj::exe == nullptr);
+		clear_();
+		new (data_) Fn(std::forward<F>(_fun));
+		__exj::fun = []( void *_arg ) { (*static_cast<Fn *>(_arg))(); };
+		__exj::arg = data_;
+		drop_      = []( void *_arg ) { static_cast<Fn *>(_arg)->~Fn(); };
+	}
+
+	unsigned state    ( void )                 { return __exj::state; }
+	int      take     ( void )                 { return exj_take     (this); }
+	int      tryWait  ( void )                 { return exj_tryWait  (this); }
+	int      takeISR  ( void )                 { return exj_takeISR  (this); }
+	template<typename T>
+	int      waitFor  ( const T _delay )       { return exj_waitFor  (this, Clock::count(_delay)); }
+	template<typename T>
+	int      waitUntil( const T _time )        { return exj_waitUntil(this, Clock::until(_time)); }
+	int      wait     ( void )                 { return exj_wait     (this); }
+
+	private:
+	void clear_( void ) { if (drop_ != nullptr) drop_(data_); drop_ = nullptr; __exj::fun = nullptr; }
+
+	void (*drop_)( void * );
+	alignas(std::max_align_t)
+	char data_[size_];
+};
+
+using ExecutorJob = ExecutorJobT<>;
+
+#endif
+
+/******************************************************************************
+ *
+ * Class             : ExecutorT<>
+ *
+ * Description       : create and initialize an executor object
+ *
+ * Constructor parameters
+ *   limit           : number of worker tasks
+ *   size            : size of the stack of worker task (in bytes)
+ *   prio            : priority of worker tasks
+ *
+ * Note              : worker tasks must be started with start()
+ *
+ ******************************************************************************/
+
+template<unsigned limit_, size_t size_ = OS_STACK_SIZE>
+struct ExecutorT : public __exe
+{
+	static_assert(size_>sizeof(ctx_t), "incorrect stack size");
+
+	ExecutorT( const unsigned _prio ): __exe _EXE_INIT(_prio, limit_, workers_, stack_[0], STK_OVER(size_)), workers_{} {}
+
+	ExecutorT( ExecutorT&& ) = delete;
+	ExecutorT( const ExecutorT& ) = delete;
+	ExecutorT& operator=( ExecutorT&& ) = delete;
+	ExecutorT& operator=( const ExecutorT& ) = delete;
+
+	~ExecutorT( void ) { assert(__exe::head == nullptr); assert(__exe::busy == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<ExecutorT<limit_, size_>>;
+#else
+	using Ptr = ExecutorT<limit_, size_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : ExecutorT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources and start its worker tasks
+ *
+ * Parameters
+ *   prio            : priority of worker tasks
+ *
+ * Return            : std::unique_pointer / pointer to ExecutorT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( const unsigned _prio )
+	{
+		auto exe = new ExecutorT<limit_, size_>(_prio);
+		if (exe != nullptr)
+		{
+			exe->__exe::obj.res = exe;
+			exe->start();
+		}
+		return Ptr(exe);
+	}
+
+	void     start    ( void )                        {        exe_start    (this); }
+	void     reset    ( void )                        {        exe_reset    (this); }
+	void     kill     ( void )                        {        exe_kill     (this); }
+	void     destroy  ( void )                        {        exe_destroy  (this); }
+	int      give     ( __exj *_job, unsigned _prio = 0 ) { return exe_give     (this, _job, _prio); }
+	int      giveISR  ( __exj *_job, unsigned _prio = 0 ) { return exe_giveISR  (this, _job, _prio); }
+	int      cancel   ( __exj *_job )                 { return exe_cancel   (this, _job); }
+	int      cancelISR( __exj *_job )                 { return exe_cancelISR(this, _job); }
+	unsigned count    ( void )                        { return exe_count    (this); }
+	unsigned countISR ( void )                        { return exe_countISR (this); }
+
+	private:
+	tsk_t workers_[limit_];
+#if __cplusplus >= 201703 && !defined(__ICCARM__)
+	stk_t stack_[limit_][STK_SIZE(size_)] __STKALIGN;
+#else
+	stk_t stack_[limit_][STK_SIZE(size_)];
+#endif
+};
+
+}     //  namespace
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_EXE_H
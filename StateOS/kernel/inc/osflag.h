@@ -392,6 +392,9 @@ int flg_wait( flg_t *flg, unsigned flags, unsigned mode ) { return flg_waitFor(f
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue
+ *                     and returns the posted flags (not the flags after setting),
+ *                     or 0 if the deferred services queue is full and the request was dropped
  *
  ******************************************************************************/
 
@@ -400,8 +403,12 @@ unsigned flg_give( flg_t *flg, unsigned flags );
 __STATIC_INLINE
 unsigned flg_set( flg_t *flg, unsigned flags ) { return flg_give(flg, flags); }
 
+#if OS_DEFER_SIZE
+unsigned flg_giveISR( flg_t *flg, unsigned flags );
+#else
 __STATIC_INLINE
 unsigned flg_giveISR( flg_t *flg, unsigned flags ) { return flg_give(flg, flags); }
+#endif
 
 /******************************************************************************
  *
@@ -367,6 +367,33 @@ int job_wait( job_t *job ) { return job_waitFor(job, INFINITE); }
 int job_waitAsync( job_t *job );
 #endif
 
+/******************************************************************************
+ *
+ * Name              : job_takeMany
+ * ISR alias         : job_takeManyISR
+ *
+ * Description       : try to transfer as many job procedures as possible (but not more than given number) from the job queue object,
+ *                     don't wait if the job queue object is empty
+ *
+ * Parameters
+ *   job             : pointer to job queue object
+ *   data            : pointer to the array to store job procedures
+ *   count           : max number of job procedures to transfer
+ *
+ * Return            : number of job procedures transferred from the job queue object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     all job procedures are transferred in a single critical section
+ *                     job procedures are not executed, the caller is responsible for executing them
+ *
+ ******************************************************************************/
+
+unsigned job_takeMany( job_t *job, fun_t **data, unsigned count );
+
+__STATIC_INLINE
+unsigned job_takeManyISR( job_t *job, fun_t **data, unsigned count ) { return job_takeMany(job, data, count); }
+
 /******************************************************************************
  *
  * Name              : job_give
@@ -387,13 +414,21 @@ int job_waitAsync( job_t *job );
  * Note              : can be used in both thread and handler mode
  *                     use ISR alias in blockable interrupt handlers
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue:
+ *                     E_SUCCESS means the request was queued, a full job queue object is never reported
+ *                     (the job procedure is dropped by the request if the job queue object is full then),
+ *                     E_TIMEOUT means the deferred services queue is full and the request was dropped
  *
  ******************************************************************************/
 
 int job_give( job_t *job, fun_t *fun );
 
+#if OS_DEFER_SIZE
+int job_giveISR( job_t *job, fun_t *fun );
+#else
 __STATIC_INLINE
 int job_giveISR( job_t *job, fun_t *fun ) { return job_give(job, fun); }
+#endif
 
 #if OS_ATOMICS
 int job_giveAsync( job_t *job, fun_t *fun );
@@ -494,13 +529,19 @@ int job_sendAsync( job_t *job, fun_t *fun );
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue,
+ *                     the request is dropped if the deferred services queue is full (see sys_deferOverflow)
  *
  ******************************************************************************/
 
 void job_push( job_t *job, fun_t *fun );
 
+#if OS_DEFER_SIZE
+void job_pushISR( job_t *job, fun_t *fun );
+#else
 __STATIC_INLINE
 void job_pushISR( job_t *job, fun_t *fun ) { job_push(job, fun); }
+#endif
 
 /******************************************************************************
  *
@@ -642,6 +683,8 @@ struct JobQueueT : public __job
 	template<typename T>
 	int      waitUntil( const T _time )               { return job_waitUntil(this, Clock::until(_time)); }
 	int      wait     ( void )                        { return job_wait     (this); }
+	unsigned takeMany ( fun_t **_data, unsigned _count ) { return job_takeMany   (this, _data, _count); }
+	unsigned takeManyISR( fun_t **_data, unsigned _count ) { return job_takeManyISR(this, _data, _count); }
 	int      give     ( fun_t *_fun )                 { return job_give     (this, _fun); }
 	int      giveISR  ( fun_t *_fun )                 { return job_giveISR  (this, _fun); }
 	template<typename T>
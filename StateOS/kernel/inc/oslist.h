@@ -366,13 +366,20 @@ int lst_wait( lst_t *lst, void **data ) { return lst_waitFor(lst, data, INFINITE
  * Return            : none
  *
  * Note              : may be used both in thread and handler mode
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue,
+ *                     if the deferred services queue is full, the memory object is given directly (it is never lost),
+ *                     so unless the queue never overflows, the ISR alias must not be used above OS_LOCK_LEVEL
  *
  ******************************************************************************/
 
 void lst_give( lst_t *lst, void *data );
 
+#if OS_DEFER_SIZE
+void lst_giveISR( lst_t *lst, void *data );
+#else
 __STATIC_INLINE
 void lst_giveISR( lst_t *lst, void *data ) { lst_give(lst, data); }
+#endif
 
 #ifdef __cplusplus
 }
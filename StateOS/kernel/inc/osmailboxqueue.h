@@ -54,6 +54,9 @@ struct __box
 	size_t   head;  // first element to read from data buffer
 	size_t   tail;  // first element to write into data buffer
 	char *   data;  // data buffer
+
+	void *   loaned;   // slot loaned by the producer, NULL if none
+	void *   borrowed; // slot borrowed by the consumer, NULL if none
 };
 
 #ifdef __cplusplus
@@ -77,7 +80,7 @@ extern "C" {
  *
  ******************************************************************************/
 
-#define               _BOX_INIT( _limit, _size, _data ) { _OBJ_INIT(), 0, _limit * _size, _size, 0, 0, _data }
+#define               _BOX_INIT( _limit, _size, _data ) { _OBJ_INIT(), 0, _limit * _size, _size, 0, 0, _data, NULL, NULL }
 
 /******************************************************************************
  *
@@ -507,6 +510,8 @@ int box_sendAsync( box_t *box, const void *data );
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     mailbox data is dropped if a slot is loaned, or if the mailbox queue object is full
+ *                     and the oldest mailbox data is borrowed
  *
  ******************************************************************************/
 
@@ -515,6 +520,276 @@ void box_push( box_t *box, const void *data );
 __STATIC_INLINE
 void box_pushISR( box_t *box, const void *data ) { box_push(box, data); }
 
+/******************************************************************************
+ *
+ * Name              : box_giveMany
+ * ISR alias         : box_giveManyISR
+ *
+ * Description       : try to transfer as many mails as possible (but not more than given number) to the mailbox queue object,
+ *                     don't wait if the mailbox queue object is full
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   data            : pointer to the array of mails
+ *   count           : max number of mails to transfer
+ *
+ * Return            : number of mails transferred to the mailbox queue object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     all mails are transferred in a single critical section
+ *
+ ******************************************************************************/
+
+unsigned box_giveMany( box_t *box, const void *data, unsigned count );
+
+__STATIC_INLINE
+unsigned box_giveManyISR( box_t *box, const void *data, unsigned count ) { return box_giveMany(box, data, count); }
+
+/******************************************************************************
+ *
+ * Name              : box_takeMany
+ * ISR alias         : box_takeManyISR
+ *
+ * Description       : try to transfer as many mails as possible (but not more than given number) from the mailbox queue object,
+ *                     don't wait if the mailbox queue object is empty
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   data            : pointer to the array to store mails
+ *   count           : max number of mails to transfer
+ *
+ * Return            : number of mails transferred from the mailbox queue object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     all mails are transferred in a single critical section
+ *
+ ******************************************************************************/
+
+unsigned box_takeMany( box_t *box, void *data, unsigned count );
+
+__STATIC_INLINE
+unsigned box_takeManyISR( box_t *box, void *data, unsigned count ) { return box_takeMany(box, data, count); }
+
+/******************************************************************************
+ *
+ * Name              : box_loan
+ * ISR alias         : box_loanISR
+ *
+ * Description       : try to get the address of the next free slot of the mailbox queue object,
+ *                     don't wait if the mailbox queue object is full,
+ *                     the slot has to be filled in place and published with box_publish
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   slot            : pointer to the variable getting the address of the slot
+ *
+ * Return
+ *   E_SUCCESS       : the slot was successfully loaned
+ *   E_TIMEOUT       : mailbox queue object is full, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the loaned slot is occupied until it is published: other producers (copying or loaning)
+ *                     get E_TIMEOUT or wait until then, box_push drops its mailbox data then
+ *
+ ******************************************************************************/
+
+int box_loan( box_t *box, void **slot );
+
+__STATIC_INLINE
+int box_loanISR( box_t *box, void **slot ) { return box_loan(box, slot); }
+
+/******************************************************************************
+ *
+ * Name              : box_loanFor
+ *
+ * Description       : try to get the address of the next free slot of the mailbox queue object,
+ *                     wait for given duration of time while the mailbox queue object is full,
+ *                     the slot has to be filled in place and published with box_publish
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   slot            : pointer to the variable getting the address of the slot
+ *   delay           : duration of time (maximum number of ticks to wait while the mailbox queue object is full)
+ *                     IMMEDIATE: don't wait if the mailbox queue object is full
+ *                     INFINITE:  wait indefinitely while the mailbox queue object is full
+ *
+ * Return
+ *   E_SUCCESS       : the slot was successfully loaned
+ *   E_STOPPED       : mailbox queue object was reseted before the specified timeout expired
+ *   E_DELETED       : mailbox queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : mailbox queue object is full and no slot was released before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the loaned slot is occupied until it is published: other producers (copying or loaning)
+ *                     get E_TIMEOUT or wait until then, box_push drops its mailbox data then
+ *
+ ******************************************************************************/
+
+int box_loanFor( box_t *box, void **slot, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : box_loanUntil
+ *
+ * Description       : try to get the address of the next free slot of the mailbox queue object,
+ *                     wait until given timepoint while the mailbox queue object is full,
+ *                     the slot has to be filled in place and published with box_publish
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   slot            : pointer to the variable getting the address of the slot
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the slot was successfully loaned
+ *   E_STOPPED       : mailbox queue object was reseted before the specified timeout expired
+ *   E_DELETED       : mailbox queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : mailbox queue object is full and no slot was released before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the loaned slot is occupied until it is published: other producers (copying or loaning)
+ *                     get E_TIMEOUT or wait until then, box_push drops its mailbox data then
+ *
+ ******************************************************************************/
+
+int box_loanUntil( box_t *box, void **slot, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : box_publish
+ * ISR alias         : box_publishISR
+ *
+ * Description       : transfer the mail filled in the slot loaned with box_loan to the mailbox queue object,
+ *                     resume a task waiting to receive mailbox data
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   slot            : address of the loaned slot
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+void box_publish( box_t *box, void *slot );
+
+__STATIC_INLINE
+void box_publishISR( box_t *box, void *slot ) { box_publish(box, slot); }
+
+/******************************************************************************
+ *
+ * Name              : box_borrow
+ * ISR alias         : box_borrowISR
+ *
+ * Description       : try to get the address of the oldest mail of the mailbox queue object,
+ *                     don't wait if the mailbox queue object is empty,
+ *                     the mail has to be read in place and released with box_release
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   slot            : pointer to the variable getting the address of the slot
+ *
+ * Return
+ *   E_SUCCESS       : the slot was successfully borrowed
+ *   E_TIMEOUT       : mailbox queue object is empty, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the borrowed slot is occupied until it is released: other consumers (copying or borrowing)
+ *                     get E_TIMEOUT or wait until then, box_push never removes the borrowed mail
+ *
+ ******************************************************************************/
+
+int box_borrow( box_t *box, void **slot );
+
+__STATIC_INLINE
+int box_borrowISR( box_t *box, void **slot ) { return box_borrow(box, slot); }
+
+/******************************************************************************
+ *
+ * Name              : box_borrowFor
+ *
+ * Description       : try to get the address of the oldest mail of the mailbox queue object,
+ *                     wait for given duration of time while the mailbox queue object is empty,
+ *                     the mail has to be read in place and released with box_release
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   slot            : pointer to the variable getting the address of the slot
+ *   delay           : duration of time (maximum number of ticks to wait while the mailbox queue object is empty)
+ *                     IMMEDIATE: don't wait if the mailbox queue object is empty
+ *                     INFINITE:  wait indefinitely while the mailbox queue object is empty
+ *
+ * Return
+ *   E_SUCCESS       : the slot was successfully borrowed
+ *   E_STOPPED       : mailbox queue object was reseted before the specified timeout expired
+ *   E_DELETED       : mailbox queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : mailbox queue object is empty and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the borrowed slot is occupied until it is released: other consumers (copying or borrowing)
+ *                     get E_TIMEOUT or wait until then, box_push never removes the borrowed mail
+ *
+ ******************************************************************************/
+
+int box_borrowFor( box_t *box, void **slot, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : box_borrowUntil
+ *
+ * Description       : try to get the address of the oldest mail of the mailbox queue object,
+ *                     wait until given timepoint while the mailbox queue object is empty,
+ *                     the mail has to be read in place and released with box_release
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   slot            : pointer to the variable getting the address of the slot
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the slot was successfully borrowed
+ *   E_STOPPED       : mailbox queue object was reseted before the specified timeout expired
+ *   E_DELETED       : mailbox queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : mailbox queue object is empty and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the borrowed slot is occupied until it is released: other consumers (copying or borrowing)
+ *                     get E_TIMEOUT or wait until then, box_push never removes the borrowed mail
+ *
+ ******************************************************************************/
+
+int box_borrowUntil( box_t *box, void **slot, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : box_release
+ * ISR alias         : box_releaseISR
+ *
+ * Description       : remove the mail borrowed with box_borrow from the mailbox queue object,
+ *                     resume a task waiting to send mailbox data
+ *
+ * Parameters
+ *   box             : pointer to mailbox queue object
+ *   slot            : address of the borrowed slot
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+void box_release( box_t *box, void *slot );
+
+__STATIC_INLINE
+void box_releaseISR( box_t *box, void *slot ) { box_release(box, slot); }
+
 /******************************************************************************
  *
  * Name              : box_count
@@ -588,6 +863,8 @@ unsigned box_limitISR( box_t *box ) { return box_limit(box); }
 /* -------------------------------------------------------------------------- */
 
 #ifdef __cplusplus
+#include <new>
+#include <utility>
 namespace stateos {
 
 /******************************************************************************
@@ -666,6 +943,26 @@ struct MailBoxQueueT : public __box
 	int      send     ( const void *_data )                 { return box_send     (this, _data); }
 	void     push     ( const void *_data )                 {        box_push     (this, _data); }
 	void     pushISR  ( const void *_data )                 {        box_pushISR  (this, _data); }
+	unsigned giveMany ( const void *_data, unsigned _count ){ return box_giveMany (this, _data, _count); }
+	unsigned giveManyISR( const void *_data, unsigned _count ){ return box_giveManyISR(this, _data, _count); }
+	unsigned takeMany (       void *_data, unsigned _count ){ return box_takeMany (this, _data, _count); }
+	unsigned takeManyISR(     void *_data, unsigned _count ){ return box_takeManyISR(this, _data, _count); }
+	int      loan     (       void **_slot )                { return box_loan     (this, _slot); }
+	int      loanISR  (       void **_slot )                { return box_loanISR  (this, _slot); }
+	template<typename T>
+	int      loanFor  (       void **_slot, const T _delay ){ return box_loanFor  (this, _slot, Clock::count(_delay)); }
+	template<typename T>
+	int      loanUntil(       void **_slot, const T _time ) { return box_loanUntil(this, _slot, Clock::until(_time)); }
+	void     publish  (       void  *_slot )                {        box_publish  (this, _slot); }
+	void     publishISR(      void  *_slot )                {        box_publishISR(this, _slot); }
+	int      borrow   (       void **_slot )                { return box_borrow   (this, _slot); }
+	int      borrowISR(       void **_slot )                { return box_borrowISR(this, _slot); }
+	template<typename T>
+	int      borrowFor(       void **_slot, const T _delay ){ return box_borrowFor(this, _slot, Clock::count(_delay)); }
+	template<typename T>
+	int      borrowUntil(     void **_slot, const T _time ) { return box_borrowUntil(this, _slot, Clock::until(_time)); }
+	void     release  (       void  *_slot )                {        box_release  (this, _slot); }
+	void     releaseISR(      void  *_slot )                {        box_releaseISR(this, _slot); }
 	unsigned count    (       void )                        { return box_count    (this); }
 	unsigned countISR (       void )                        { return box_countISR (this); }
 	unsigned space    (       void )                        { return box_space    (this); }
@@ -731,6 +1028,96 @@ struct MailBoxQueueTT : public MailBoxQueueT<limit_, sizeof(C)>
 			box->__box::obj.res = box;
 		return Ptr(box);
 	}
+
+/******************************************************************************
+ *
+ * Name              : MailBoxQueueTT<>::emplace
+ *
+ * Description       : try to construct an object in the next free slot of the mailbox queue object
+ *                     and transfer it to the mailbox queue object without copying,
+ *                     don't wait if the mailbox queue object is full
+ *
+ * Parameters
+ *   args            : arguments of the constructor of the object
+ *
+ * Return
+ *   E_SUCCESS       : the object was successfully transferred to the mailbox queue object
+ *   E_TIMEOUT       : mailbox queue object is full, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     the loaned slot is occupied until it is published: other producers (copying or loaning)
+ *                     get E_TIMEOUT or wait until then, box_push drops its mailbox data then
+ *
+ ******************************************************************************/
+
+	template<class... Args>
+	int emplace( Args&&... _args )
+	{
+		void *slot;
+		int result = box_loan(this, &slot);
+		if (result == E_SUCCESS)
+		{
+			new (slot) C(std::forward<Args>(_args)...);
+			box_publish(this, slot);
+		}
+		return result;
+	}
+
+	template<typename T, class... Args>
+	int emplaceFor( const T _delay, Args&&... _args )
+	{
+		void *slot;
+		int result = box_loanFor(this, &slot, Clock::count(_delay));
+		if (result == E_SUCCESS)
+		{
+			new (slot) C(std::forward<Args>(_args)...);
+			box_publish(this, slot);
+		}
+		return result;
+	}
+
+	template<typename T, class... Args>
+	int emplaceUntil( const T _time, Args&&... _args )
+	{
+		void *slot;
+		int result = box_loanUntil(this, &slot, Clock::until(_time));
+		if (result == E_SUCCESS)
+		{
+			new (slot) C(std::forward<Args>(_args)...);
+			box_publish(this, slot);
+		}
+		return result;
+	}
+
+/******************************************************************************
+ *
+ * Name              : MailBoxQueueTT<>::borrow
+ *
+ * Description       : try to get access to the oldest object of the mailbox queue object without copying,
+ *                     the object has to be released with release
+ *
+ * Parameters
+ *   data            : reference to the pointer getting the address of the object
+ *   delay / time    : (borrowFor / borrowUntil) duration of time / timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the object was successfully borrowed
+ *   E_TIMEOUT       : mailbox queue object is empty
+ *
+ * Note              : the borrowed object is occupied until it is released: other consumers
+ *                     get E_TIMEOUT or wait until then
+ *                     release destroys the object
+ *
+ ******************************************************************************/
+
+	int borrow   ( C *&_data )                 { void *slot = nullptr; int result = box_borrow   (this, &slot);                       _data = static_cast<C *>(slot); return result; }
+	int borrowISR( C *&_data )                 { void *slot = nullptr; int result = box_borrowISR(this, &slot);                       _data = static_cast<C *>(slot); return result; }
+	template<typename T>
+	int borrowFor( C *&_data, const T _delay ) { void *slot = nullptr; int result = box_borrowFor(this, &slot, Clock::count(_delay)); _data = static_cast<C *>(slot); return result; }
+	template<typename T>
+	int borrowUntil( C *&_data, const T _time ){ void *slot = nullptr; int result = box_borrowUntil(this, &slot, Clock::until(_time)); _data = static_cast<C *>(slot); return result; }
+	void release   ( C *_data )                { _data->~C(); box_release   (this, _data); }
+	void releaseISR( C *_data )                { _data->~C(); box_releaseISR(this, _data); }
 };
 
 }     //  namespace
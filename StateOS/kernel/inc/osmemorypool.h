@@ -405,6 +405,9 @@ int mem_wait( mem_t *mem, void **data ) { return lst_wait(&mem->lst, data); }
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue,
+ *                     if the deferred services queue is full, the memory object is given directly (it is never lost),
+ *                     so unless the queue never overflows, the ISR alias must not be used above OS_LOCK_LEVEL
  *
  ******************************************************************************/
 
@@ -53,6 +53,23 @@ struct __msg
 	size_t   head;  // inherited from stream buffer
 	size_t   tail;  // inherited from stream buffer
 	char *   data;  // inherited from stream buffer
+
+	size_t   items; // number of messages in the buffer
+};
+
+/******************************************************************************
+ *
+ * Name              : message vector element
+ *
+ ******************************************************************************/
+
+typedef struct __iov iov_t;
+
+struct __iov
+{
+	const
+	void *   data;  // pointer to the part of the message
+	size_t   size;  // size of the part of the message
 };
 
 #ifdef __cplusplus
@@ -75,7 +92,7 @@ extern "C" {
  *
  ******************************************************************************/
 
-#define               _MSG_INIT( _limit, _data ) { _OBJ_INIT(), 0, _limit, 0, 0, _data }
+#define               _MSG_INIT( _limit, _data ) { _OBJ_INIT(), 0, _limit, 0, 0, _data, 0 }
 
 /******************************************************************************
  *
@@ -387,6 +404,40 @@ int msg_waitUntil( msg_t *msg, void *data, size_t size, size_t *read, cnt_t time
 __STATIC_INLINE
 int msg_wait( msg_t *msg, void *data, size_t size, size_t *read ) { return msg_waitFor(msg, data, size, read, INFINITE); }
 
+/******************************************************************************
+ *
+ * Name              : msg_waitLevel
+ *
+ * Description       : try to transfer the first message from the message buffer object,
+ *                     wait while the message buffer object contains fewer than 'level' messages;
+ *                     the idle timeout is restarted each time a message arrives and when it expires
+ *                     the task receives the first of the messages available so far
+ *
+ * Parameters
+ *   msg             : pointer to message buffer object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *   level           : trigger level (number of messages that wakes up the task)
+ *   idle            : idle timeout (maximum number of ticks to wait for the next data)
+ *                     IMMEDIATE: don't wait if the trigger level is not reached
+ *                     INFINITE:  wait indefinitely while the trigger level is not reached
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the message buffer
+ *   E_FAILURE       : not enough space in the buffer
+ *   E_STOPPED       : message buffer object was reseted before the idle timeout expired
+ *   E_DELETED       : message buffer object was deleted before the idle timeout expired
+ *   E_TIMEOUT       : message buffer object is empty and was not received data before the idle timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the remaining messages can be received without waiting (msg_take)
+ *                     waiting tasks get messages regardless of their trigger levels when the buffer is full
+ *
+ ******************************************************************************/
+
+int msg_waitLevel( msg_t *msg, void *data, size_t size, size_t *read, size_t level, cnt_t idle );
+
 /******************************************************************************
  *
  * Name              : msg_give
@@ -521,6 +572,165 @@ int msg_push( msg_t *msg, const void *data, size_t size );
 __STATIC_INLINE
 int msg_pushISR( msg_t *msg, const void *data, size_t size ) { return msg_push(msg, data, size); }
 
+/******************************************************************************
+ *
+ * Name              : msg_givev
+ * ISR alias         : msg_givevISR
+ *
+ * Description       : try to transfer a message gathered from the vector of buffers to the message buffer object,
+ *                     don't wait if the message buffer object is full
+ *
+ * Parameters
+ *   msg             : pointer to message buffer object
+ *   vec             : pointer to the vector of buffers (parts of the message)
+ *   cnt             : number of elements of the vector
+ *
+ * Return
+ *   E_SUCCESS       : message data was successfully transferred to the message buffer object
+ *   E_FAILURE       : size of the message data is out of the limit
+ *   E_TIMEOUT       : not enough space in the message buffer, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int msg_givev( msg_t *msg, const iov_t *vec, unsigned cnt );
+
+__STATIC_INLINE
+int msg_givevISR( msg_t *msg, const iov_t *vec, unsigned cnt ) { return msg_givev(msg, vec, cnt); }
+
+/******************************************************************************
+ *
+ * Name              : msg_sendvFor
+ *
+ * Description       : try to transfer a message gathered from the vector of buffers to the message buffer object,
+ *                     wait for given duration of time while the message buffer object is full
+ *
+ * Parameters
+ *   msg             : pointer to message buffer object
+ *   vec             : pointer to the vector of buffers (parts of the message)
+ *   cnt             : number of elements of the vector
+ *   delay           : duration of time (maximum number of ticks to wait while the message buffer object is full)
+ *                     IMMEDIATE: don't wait if the message buffer object is full
+ *                     INFINITE:  wait indefinitely while the message buffer object is full
+ *
+ * Return
+ *   E_SUCCESS       : message data was successfully transferred to the message buffer object
+ *   E_FAILURE       : size of the message data is out of the limit
+ *   E_STOPPED       : message buffer object was reseted before the specified timeout expired
+ *   E_DELETED       : message buffer object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : message buffer object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int msg_sendvFor( msg_t *msg, const iov_t *vec, unsigned cnt, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : msg_sendvUntil
+ *
+ * Description       : try to transfer a message gathered from the vector of buffers to the message buffer object,
+ *                     wait until given timepoint while the message buffer object is full
+ *
+ * Parameters
+ *   msg             : pointer to message buffer object
+ *   vec             : pointer to the vector of buffers (parts of the message)
+ *   cnt             : number of elements of the vector
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : message data was successfully transferred to the message buffer object
+ *   E_FAILURE       : size of the message data is out of the limit
+ *   E_STOPPED       : message buffer object was reseted before the specified timeout expired
+ *   E_DELETED       : message buffer object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : message buffer object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int msg_sendvUntil( msg_t *msg, const iov_t *vec, unsigned cnt, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : msg_sendv
+ *
+ * Description       : try to transfer a message gathered from the vector of buffers to the message buffer object,
+ *                     wait indefinitely while the message buffer object is full
+ *
+ * Parameters
+ *   msg             : pointer to message buffer object
+ *   vec             : pointer to the vector of buffers (parts of the message)
+ *   cnt             : number of elements of the vector
+ *
+ * Return
+ *   E_SUCCESS       : message data was successfully transferred to the message buffer object
+ *   E_FAILURE       : size of the message data is out of the limit
+ *   E_STOPPED       : message buffer object was reseted
+ *   E_DELETED       : message buffer object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int msg_sendv( msg_t *msg, const iov_t *vec, unsigned cnt ) { return msg_sendvFor(msg, vec, cnt, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : msg_acquire
+ * ISR alias         : msg_acquireISR
+ *
+ * Description       : get access to the next message in the message buffer object without copying it,
+ *                     the message remains in the buffer until it is released with msg_release
+ *
+ * Parameters
+ *   msg             : pointer to message buffer object
+ *   vec             : pointer to the vector of two elements getting parts of the message,
+ *                     the second part is not empty only if the message wraps around the end of the buffer
+ *
+ * Return
+ *   E_SUCCESS       : the message is available
+ *   E_TIMEOUT       : message buffer object is empty, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the message buffer must have only one consumer while the message is acquired
+ *                     msg_push must not be used while the message is acquired
+ *
+ ******************************************************************************/
+
+int msg_acquire( msg_t *msg, iov_t *vec );
+
+__STATIC_INLINE
+int msg_acquireISR( msg_t *msg, iov_t *vec ) { return msg_acquire(msg, vec); }
+
+/******************************************************************************
+ *
+ * Name              : msg_release
+ * ISR alias         : msg_releaseISR
+ *
+ * Description       : remove the message acquired with msg_acquire from the message buffer object,
+ *                     resume tasks waiting to send data
+ *
+ * Parameters
+ *   msg             : pointer to message buffer object
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+void msg_release( msg_t *msg );
+
+__STATIC_INLINE
+void msg_releaseISR( msg_t *msg ) { msg_release(msg); }
+
 /******************************************************************************
  *
  * Name              : msg_count
@@ -616,6 +826,7 @@ size_t msg_sizeISR( msg_t *msg ) { return msg_size(msg); }
 /* -------------------------------------------------------------------------- */
 
 #ifdef __cplusplus
+#include <initializer_list>
 namespace stateos {
 
 /******************************************************************************
@@ -683,6 +894,8 @@ struct MessageBufferT : public __msg
 	template<typename T>
 	int    waitUntil(       void *_data, size_t _size, size_t *_read,  const T _time )  { return msg_waitUntil(this, _data, _size, _read, Clock::until(_time)); }
 	int    wait     (       void *_data, size_t _size, size_t *_read = nullptr )        { return msg_wait     (this, _data, _size, _read); }
+	template<typename T>
+	int    waitLevel(       void *_data, size_t _size, size_t *_read,  size_t _level, const T _idle ) { return msg_waitLevel(this, _data, _size, _read, _level, Clock::count(_idle)); }
 	int    give     ( const void *_data, size_t _size )                                 { return msg_give     (this, _data, _size); }
 	int    giveISR  ( const void *_data, size_t _size )                                 { return msg_giveISR  (this, _data, _size); }
 	template<typename T>
@@ -692,6 +905,24 @@ struct MessageBufferT : public __msg
 	int    send     ( const void *_data, size_t _size )                                 { return msg_send     (this, _data, _size); }
 	int    push     ( const void *_data, size_t _size )                                 { return msg_push     (this, _data, _size); }
 	int    pushISR  ( const void *_data, size_t _size )                                 { return msg_pushISR  (this, _data, _size); }
+	int    givev    ( const iov_t *_vec, unsigned _cnt )                                { return msg_givev    (this, _vec, _cnt); }
+	int    givevISR ( const iov_t *_vec, unsigned _cnt )                                { return msg_givevISR (this, _vec, _cnt); }
+	template<typename T>
+	int    sendvFor ( const iov_t *_vec, unsigned _cnt, const T _delay )                { return msg_sendvFor (this, _vec, _cnt, Clock::count(_delay)); }
+	template<typename T>
+	int    sendvUntil( const iov_t *_vec, unsigned _cnt, const T _time )                { return msg_sendvUntil(this, _vec, _cnt, Clock::until(_time)); }
+	int    sendv    ( const iov_t *_vec, unsigned _cnt )                                { return msg_sendv    (this, _vec, _cnt); }
+	int    givev    ( std::initializer_list<iov_t> _vec )                               { return msg_givev    (this, _vec.begin(), static_cast<unsigned>(_vec.size())); }
+	int    givevISR ( std::initializer_list<iov_t> _vec )                               { return msg_givevISR (this, _vec.begin(), static_cast<unsigned>(_vec.size())); }
+	template<typename T>
+	int    sendvFor ( std::initializer_list<iov_t> _vec, const T _delay )               { return msg_sendvFor (this, _vec.begin(), static_cast<unsigned>(_vec.size()), Clock::count(_delay)); }
+	template<typename T>
+	int    sendvUntil( std::initializer_list<iov_t> _vec, const T _time )               { return msg_sendvUntil(this, _vec.begin(), static_cast<unsigned>(_vec.size()), Clock::until(_time)); }
+	int    sendv    ( std::initializer_list<iov_t> _vec )                               { return msg_sendv    (this, _vec.begin(), static_cast<unsigned>(_vec.size())); }
+	int    acquire  ( iov_t *_vec )                                                     { return msg_acquire  (this, _vec); }
+	int    acquireISR( iov_t *_vec )                                                    { return msg_acquireISR(this, _vec); }
+	void   release  ( void )                                                            {        msg_release  (this); }
+	void   releaseISR( void )                                                           {        msg_releaseISR(this); }
 	size_t count    ( void )                                                            { return msg_count    (this); }
 	size_t countISR ( void )                                                            { return msg_countISR (this); }
 	size_t space    ( void )                                                            { return msg_space    (this); }
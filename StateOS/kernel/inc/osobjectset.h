@@ -0,0 +1,561 @@
+/******************************************************************************
+
+    @file    StateOS: osobjectset.h
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_SET_H
+#define __STATEOS_SET_H
+
+#include "oskernel.h"
+#include "osclock.h"
+
+#if OS_OBJ_SET
+
+/******************************************************************************
+ *
+ * Name              : object set
+ *
+ ******************************************************************************/
+
+// types of members of the object set
+enum
+{
+	setSEM = 0, // semaphore
+	setFLG,     // flag (ready if any flag is set)
+	setBOX,     // mailbox queue
+	setEVQ,     // event queue
+	setPRQ,     // priority queue
+	setSTM,     // stream buffer
+	setMSG,     // message buffer
+};
+
+typedef struct __sme sme_t;
+
+struct __sme
+{
+	obj_t  * obj;   // member object
+	unsigned type;  // type of the member object
+};
+
+typedef struct __set set_t, * const set_id;
+
+struct __set
+{
+	obj_t    obj;   // object header
+
+	unsigned count; // number of members of the object set
+	unsigned limit; // size of the object set (max number of members)
+	unsigned next;  // member to be checked first (round-robin order)
+	sme_t  * data;  // array of members
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _SET_INIT
+ *
+ * Description       : create and initialize an object set
+ *
+ * Parameters
+ *   limit           : size of the set (max number of members)
+ *   data            : object set data buffer
+ *
+ * Return            : object set
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _SET_INIT( _limit, _data ) { _OBJ_INIT(), 0, _limit, 0, _data }
+
+/******************************************************************************
+ *
+ * Name              : _SET_DATA
+ *
+ * Description       : create an object set data buffer
+ *
+ * Parameters
+ *   limit           : size of the set (max number of members)
+ *
+ * Return            : object set data buffer
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _SET_DATA( _limit ) (sme_t[_limit]){ { NULL, 0 } }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : OS_SET
+ *
+ * Description       : define and initialize an object set
+ *
+ * Parameters
+ *   set             : name of a pointer to object set
+ *   limit           : size of the set (max number of members)
+ *
+ ******************************************************************************/
+
+#define             OS_SET( set, limit )                                \
+                       sme_t set##__buf[limit];                          \
+                       set_t set##__set = _SET_INIT( limit, set##__buf ); \
+                       set_id set = & set##__set
+
+/******************************************************************************
+ *
+ * Name              : static_SET
+ *
+ * Description       : define and initialize a static object set
+ *
+ * Parameters
+ *   set             : name of a pointer to object set
+ *   limit           : size of the set (max number of members)
+ *
+ ******************************************************************************/
+
+#define         static_SET( set, limit )                                \
+                static sme_t set##__buf[limit];                          \
+                static set_t set##__set = _SET_INIT( limit, set##__buf ); \
+                static set_id set = & set##__set
+
+/******************************************************************************
+ *
+ * Name              : SET_INIT
+ *
+ * Description       : create and initialize an object set
+ *
+ * Parameters
+ *   limit           : size of the set (max number of members)
+ *
+ * Return            : object set
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                SET_INIT( limit ) \
+                      _SET_INIT( limit, _SET_DATA( limit ) )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : SET_CREATE
+ * Alias             : SET_NEW
+ *
+ * Description       : create and initialize an object set
+ *
+ * Parameters
+ *   limit           : size of the set (max number of members)
+ *
+ * Return            : pointer to object set
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                SET_CREATE( limit ) \
+           (set_t[]) { SET_INIT  ( limit ) }
+#define                SET_NEW \
+                       SET_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : set_init
+ *
+ * Description       : initialize an object set
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *   data            : object set data buffer
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void set_init( set_t *set, sme_t *data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : set_create
+ * Alias             : set_new
+ *
+ * Description       : create and initialize a new object set
+ *
+ * Parameters
+ *   limit           : size of the set (max number of members)
+ *
+ * Return            : pointer to object set
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+set_t *set_create( unsigned limit );
+
+__STATIC_INLINE
+set_t *set_new( unsigned limit ) { return set_create(limit); }
+
+/******************************************************************************
+ *
+ * Name              : set_reset
+ * Alias             : set_kill
+ *
+ * Description       : remove all members from the object set and wake up all waiting tasks with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void set_reset( set_t *set );
+
+__STATIC_INLINE
+void set_kill( set_t *set ) { set_reset(set); }
+
+/******************************************************************************
+ *
+ * Name              : set_destroy
+ * Alias             : set_delete
+ *
+ * Description       : remove all members from the object set, wake up all waiting tasks with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void set_destroy( set_t *set );
+
+__STATIC_INLINE
+void set_delete( set_t *set ) { set_destroy(set); }
+
+/******************************************************************************
+ *
+ * Name              : set_add
+ *
+ * Description       : add the object to the object set
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *   obj             : pointer to the member object
+ *   type            : type of the member object:
+ *                     setSEM: semaphore
+ *                     setFLG: flag
+ *                     setBOX: mailbox queue
+ *                     setEVQ: event queue
+ *                     setPRQ: priority queue
+ *                     setSTM: stream buffer
+ *                     setMSG: message buffer
+ *
+ * Return
+ *   E_SUCCESS       : the object was successfully added to the object set
+ *   E_FAILURE       : the object set is full or the object already belongs to an object set
+ *
+ * Note              : use only in thread mode
+ *                     the object is removed from the object set automatically when it is reset or destroyed
+ *
+ ******************************************************************************/
+
+int set_add( set_t *set, void *obj, unsigned type );
+
+/******************************************************************************
+ *
+ * Name              : set_remove
+ *
+ * Description       : remove the object from the object set
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *   obj             : pointer to the member object
+ *
+ * Return
+ *   E_SUCCESS       : the object was successfully removed from the object set
+ *   E_FAILURE       : the object doesn't belong to the object set
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int set_remove( set_t *set, void *obj );
+
+/******************************************************************************
+ *
+ * Name              : set_take
+ * Alias             : set_tryWait
+ * ISR alias         : set_takeISR
+ *
+ * Description       : check if any member of the object set is ready,
+ *                     don't wait if no member is ready
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *   obj             : pointer to the variable getting the address of the ready member
+ *
+ * Return
+ *   E_SUCCESS       : a member of the object set is ready
+ *   E_TIMEOUT       : no member of the object set is ready, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the data should be taken from the ready member with its non-blocking function,
+ *                     members are checked in round-robin order
+ *
+ ******************************************************************************/
+
+int set_take( set_t *set, void **obj );
+
+__STATIC_INLINE
+int set_tryWait( set_t *set, void **obj ) { return set_take(set, obj); }
+
+__STATIC_INLINE
+int set_takeISR( set_t *set, void **obj ) { return set_take(set, obj); }
+
+/******************************************************************************
+ *
+ * Name              : set_waitFor
+ *
+ * Description       : check if any member of the object set is ready,
+ *                     wait for given duration of time while no member is ready
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *   obj             : pointer to the variable getting the address of the ready member
+ *   delay           : duration of time (maximum number of ticks to wait while no member is ready)
+ *                     IMMEDIATE: don't wait if no member is ready
+ *                     INFINITE:  wait indefinitely while no member is ready
+ *
+ * Return
+ *   E_SUCCESS       : a member of the object set is ready
+ *   E_STOPPED       : object set was reseted before the specified timeout expired
+ *   E_DELETED       : object set was deleted before the specified timeout expired
+ *   E_TIMEOUT       : no member of the object set became ready before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the data should be taken from the ready member with its non-blocking function
+ *
+ ******************************************************************************/
+
+int set_waitFor( set_t *set, void **obj, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : set_waitUntil
+ *
+ * Description       : check if any member of the object set is ready,
+ *                     wait until given timepoint while no member is ready
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *   obj             : pointer to the variable getting the address of the ready member
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : a member of the object set is ready
+ *   E_STOPPED       : object set was reseted before the specified timeout expired
+ *   E_DELETED       : object set was deleted before the specified timeout expired
+ *   E_TIMEOUT       : no member of the object set became ready before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the data should be taken from the ready member with its non-blocking function
+ *
+ ******************************************************************************/
+
+int set_waitUntil( set_t *set, void **obj, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : set_wait
+ *
+ * Description       : check if any member of the object set is ready,
+ *                     wait indefinitely while no member is ready
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *   obj             : pointer to the variable getting the address of the ready member
+ *
+ * Return
+ *   E_SUCCESS       : a member of the object set is ready
+ *   E_STOPPED       : object set was reseted
+ *   E_DELETED       : object set was deleted
+ *
+ * Note              : use only in thread mode
+ *                     the data should be taken from the ready member with its non-blocking function
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int set_wait( set_t *set, void **obj ) { return set_waitFor(set, obj, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : set_count
+ * ISR alias         : set_countISR
+ *
+ * Description       : return the number of members of the object set
+ *
+ * Parameters
+ *   set             : pointer to object set
+ *
+ * Return            : number of members of the object set
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned set_count( set_t *set );
+
+__STATIC_INLINE
+unsigned set_countISR( set_t *set ) { return set_count(set); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+#include "ossemaphore.h"
+#include "osflag.h"
+#include "osmailboxqueue.h"
+#include "oseventqueue.h"
+#include "ospriorityqueue.h"
+#include "osstreambuffer.h"
+#include "osmessagebuffer.h"
+namespace stateos {
+
+/******************************************************************************
+ *
+ * Class             : ObjectSetT<>
+ *
+ * Description       : create and initialize an object set
+ *
+ * Constructor parameters
+ *   limit           : size of the set (max number of members)
+ *
+ ******************************************************************************/
+
+template<unsigned limit_>
+struct ObjectSetT : public __set
+{
+	constexpr
+	ObjectSetT( void ): __set _SET_INIT(limit_, data_) {}
+
+	ObjectSetT( ObjectSetT&& ) = default;
+	ObjectSetT( const ObjectSetT& ) = delete;
+	ObjectSetT& operator=( ObjectSetT&& ) = delete;
+	ObjectSetT& operator=( const ObjectSetT& ) = delete;
+
+	~ObjectSetT( void ) { assert(__set::obj.queue == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<ObjectSetT<limit_>>;
+#else
+	using Ptr = ObjectSetT<limit_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : ObjectSetT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   limit           : size of the set (max number of members)
+ *
+ * Return            : std::unique_pointer / pointer to ObjectSetT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto set = new ObjectSetT<limit_>();
+		if (set != nullptr)
+			set->__set::obj.res = set;
+		return Ptr(set);
+	}
+
+	void     reset    ( void )                           {        set_reset    (this); }
+	void     kill     ( void )                           {        set_kill     (this); }
+	void     destroy  ( void )                           {        set_destroy  (this); }
+	int      add      ( __sem *_obj )                    { return set_add      (this, _obj, setSEM); }
+	int      add      ( __flg *_obj )                    { return set_add      (this, _obj, setFLG); }
+	int      add      ( __box *_obj )                    { return set_add      (this, _obj, setBOX); }
+	int      add      ( __evq *_obj )                    { return set_add      (this, _obj, setEVQ); }
+	int      add      ( __prq *_obj )                    { return set_add      (this, _obj, setPRQ); }
+	int      add      ( __stm *_obj )                    { return set_add      (this, _obj, setSTM); }
+	int      add      ( __msg *_obj )                    { return set_add      (this, _obj, setMSG); }
+	int      remove   ( void  *_obj )                    { return set_remove   (this, _obj); }
+	int      take     ( void **_obj )                    { return set_take     (this, _obj); }
+	int      tryWait  ( void **_obj )                    { return set_tryWait  (this, _obj); }
+	int      takeISR  ( void **_obj )                    { return set_takeISR  (this, _obj); }
+	template<typename T>
+	int      waitFor  ( void **_obj, const T _delay )    { return set_waitFor  (this, _obj, Clock::count(_delay)); }
+	template<typename T>
+	int      waitUntil( void **_obj, const T _time )     { return set_waitUntil(this, _obj, Clock::until(_time)); }
+	int      wait     ( void **_obj )                    { return set_wait     (this, _obj); }
+	unsigned count    ( void )                           { return set_count    (this); }
+	unsigned countISR ( void )                           { return set_countISR (this); }
+
+	private:
+	sme_t data_[limit_];
+};
+
+}     //  namespace
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_OBJ_SET
+
+#endif//__STATEOS_SET_H
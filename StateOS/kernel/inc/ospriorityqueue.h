@@ -0,0 +1,734 @@
+/******************************************************************************
+
+    @file    StateOS: ospriorityqueue.h
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_PRQ_H
+#define __STATEOS_PRQ_H
+
+#include "oskernel.h"
+#include "osclock.h"
+
+/* -------------------------------------------------------------------------- */
+
+#define PRQ_SIZE( limit, size ) \
+    ((size_t)( limit ) * (sizeof(prn_t) + (size_t)( size )))
+
+/******************************************************************************
+ *
+ * Name              : priority queue
+ *
+ ******************************************************************************/
+
+typedef struct __prn prn_t;
+
+struct __prn
+{
+	unsigned prio;  // priority of the mail
+	unsigned seq;   // sequence number of the mail (fifo order within the priority)
+	unsigned slot;  // index of the mail in the data buffer
+};
+
+typedef struct __prq prq_t, * const prq_id;
+
+struct __prq
+{
+	obj_t    obj;   // object header
+
+	unsigned count; // number of mails in the priority queue
+	unsigned limit; // size of the priority queue (max number of stored mails)
+	size_t   size;  // size of a single mail (in bytes)
+
+	unsigned used;  // number of slots of the data buffer used since the last reset
+	unsigned seq;   // sequence number of the next mail
+	prn_t  * node;  // heap of mails ordered by priority, followed by free slots
+	char   * data;  // data buffer
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _PRQ_INIT
+ *
+ * Description       : create and initialize a priority queue object
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   size            : size of a single mail (in bytes)
+ *   node            : priority queue heap buffer
+ *   data            : priority queue data buffer
+ *
+ * Return            : priority queue object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _PRQ_INIT( _limit, _size, _node, _data ) { _OBJ_INIT(), 0, _limit, _size, 0, 0, _node, _data }
+
+/******************************************************************************
+ *
+ * Name              : _PRQ_NODE
+ *
+ * Description       : create a priority queue heap buffer
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *
+ * Return            : priority queue heap buffer
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _PRQ_NODE( _limit ) (prn_t[_limit]){ { 0, 0, 0 } }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _PRQ_DATA
+ *
+ * Description       : create a priority queue data buffer
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   size            : size of a single mail (in bytes)
+ *
+ * Return            : priority queue data buffer
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _PRQ_DATA( _limit, _size ) (char[_limit * _size]){ 0 }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : OS_PRQ
+ *
+ * Description       : define and initialize a priority queue object
+ *
+ * Parameters
+ *   prq             : name of a pointer to priority queue object
+ *   limit           : size of a queue (max number of stored mails)
+ *   size            : size of a single mail (in bytes)
+ *
+ ******************************************************************************/
+
+#define             OS_PRQ( prq, limit, size )                                                \
+                       prn_t prq##__node[limit];                                               \
+                       char  prq##__buf[limit * size];                                          \
+                       prq_t prq##__prq = _PRQ_INIT( limit, size, prq##__node, prq##__buf ); \
+                       prq_id prq = & prq##__prq
+
+/******************************************************************************
+ *
+ * Name              : static_PRQ
+ *
+ * Description       : define and initialize a static priority queue object
+ *
+ * Parameters
+ *   prq             : name of a pointer to priority queue object
+ *   limit           : size of a queue (max number of stored mails)
+ *   size            : size of a single mail (in bytes)
+ *
+ ******************************************************************************/
+
+#define         static_PRQ( prq, limit, size )                                                \
+                static prn_t prq##__node[limit];                                               \
+                static char  prq##__buf[limit * size];                                          \
+                static prq_t prq##__prq = _PRQ_INIT( limit, size, prq##__node, prq##__buf ); \
+                static prq_id prq = & prq##__prq
+
+/******************************************************************************
+ *
+ * Name              : PRQ_INIT
+ *
+ * Description       : create and initialize a priority queue object
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   size            : size of a single mail (in bytes)
+ *
+ * Return            : priority queue object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                PRQ_INIT( limit, size ) \
+                      _PRQ_INIT( limit, size, _PRQ_NODE( limit ), _PRQ_DATA( limit, size ) )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : PRQ_CREATE
+ * Alias             : PRQ_NEW
+ *
+ * Description       : create and initialize a priority queue object
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   size            : size of a single mail (in bytes)
+ *
+ * Return            : pointer to priority queue object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                PRQ_CREATE( limit, size ) \
+           (prq_t[]) { PRQ_INIT  ( limit, size ) }
+#define                PRQ_NEW \
+                       PRQ_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : prq_init
+ *
+ * Description       : initialize a priority queue object
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *   size            : size of a single mail (in bytes)
+ *   data            : priority queue data buffer (aligned to the size of unsigned),
+ *                     contains both the heap and the mails,
+ *                     PRQ_SIZE(limit, size) bytes are needed for 'limit' mails
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void prq_init( prq_t *prq, size_t size, void *data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : prq_create
+ * Alias             : prq_new
+ *
+ * Description       : create and initialize a new priority queue object
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   size            : size of a single mail (in bytes)
+ *
+ * Return            : pointer to priority queue object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+prq_t *prq_create( unsigned limit, size_t size );
+
+__STATIC_INLINE
+prq_t *prq_new( unsigned limit, size_t size ) { return prq_create(limit, size); }
+
+/******************************************************************************
+ *
+ * Name              : prq_reset
+ * Alias             : prq_kill
+ *
+ * Description       : reset the priority queue object and wake up all waiting tasks with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void prq_reset( prq_t *prq );
+
+__STATIC_INLINE
+void prq_kill( prq_t *prq ) { prq_reset(prq); }
+
+/******************************************************************************
+ *
+ * Name              : prq_destroy
+ * Alias             : prq_delete
+ *
+ * Description       : reset the priority queue object, wake up all waiting tasks with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void prq_destroy( prq_t *prq );
+
+__STATIC_INLINE
+void prq_delete( prq_t *prq ) { prq_destroy(prq); }
+
+/******************************************************************************
+ *
+ * Name              : prq_take
+ * Alias             : prq_tryWait
+ * ISR alias         : prq_takeISR
+ *
+ * Description       : try to transfer the mail with the highest priority from the priority queue object,
+ *                     mails with the same priority are transferred in fifo order,
+ *                     don't wait if the priority queue object is empty
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *   data            : pointer to store mail data
+ *   prio            : pointer to store priority of the mail, can be NULL
+ *
+ * Return
+ *   E_SUCCESS       : mail data was successfully transferred from the priority queue object
+ *   E_TIMEOUT       : priority queue object is empty, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int prq_take( prq_t *prq, void *data, unsigned *prio );
+
+__STATIC_INLINE
+int prq_tryWait( prq_t *prq, void *data, unsigned *prio ) { return prq_take(prq, data, prio); }
+
+__STATIC_INLINE
+int prq_takeISR( prq_t *prq, void *data, unsigned *prio ) { return prq_take(prq, data, prio); }
+
+/******************************************************************************
+ *
+ * Name              : prq_waitFor
+ *
+ * Description       : try to transfer the mail with the highest priority from the priority queue object,
+ *                     wait for given duration of time while the priority queue object is empty
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *   data            : pointer to store mail data
+ *   prio            : pointer to store priority of the mail, can be NULL
+ *   delay           : duration of time (maximum number of ticks to wait while the priority queue object is empty)
+ *                     IMMEDIATE: don't wait if the priority queue object is empty
+ *                     INFINITE:  wait indefinitely while the priority queue object is empty
+ *
+ * Return
+ *   E_SUCCESS       : mail data was successfully transferred from the priority queue object
+ *   E_STOPPED       : priority queue object was reseted before the specified timeout expired
+ *   E_DELETED       : priority queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : priority queue object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int prq_waitFor( prq_t *prq, void *data, unsigned *prio, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : prq_waitUntil
+ *
+ * Description       : try to transfer the mail with the highest priority from the priority queue object,
+ *                     wait until given timepoint while the priority queue object is empty
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *   data            : pointer to store mail data
+ *   prio            : pointer to store priority of the mail, can be NULL
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : mail data was successfully transferred from the priority queue object
+ *   E_STOPPED       : priority queue object was reseted before the specified timeout expired
+ *   E_DELETED       : priority queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : priority queue object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int prq_waitUntil( prq_t *prq, void *data, unsigned *prio, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : prq_wait
+ *
+ * Description       : try to transfer the mail with the highest priority from the priority queue object,
+ *                     wait indefinitely while the priority queue object is empty
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *   data            : pointer to store mail data
+ *   prio            : pointer to store priority of the mail, can be NULL
+ *
+ * Return
+ *   E_SUCCESS       : mail data was successfully transferred from the priority queue object
+ *   E_STOPPED       : priority queue object was reseted
+ *   E_DELETED       : priority queue object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int prq_wait( prq_t *prq, void *data, unsigned *prio ) { return prq_waitFor(prq, data, prio, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : prq_give
+ * ISR alias         : prq_giveISR
+ *
+ * Description       : try to transfer mail data with given priority to the priority queue object,
+ *                     don't wait if the priority queue object is full
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *   data            : pointer to mail data
+ *   prio            : priority of the mail (the higher value, the higher priority)
+ *
+ * Return
+ *   E_SUCCESS       : mail data was successfully transferred to the priority queue object
+ *   E_TIMEOUT       : priority queue object is full, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int prq_give( prq_t *prq, const void *data, unsigned prio );
+
+__STATIC_INLINE
+int prq_giveISR( prq_t *prq, const void *data, unsigned prio ) { return prq_give(prq, data, prio); }
+
+/******************************************************************************
+ *
+ * Name              : prq_sendFor
+ *
+ * Description       : try to transfer mail data with given priority to the priority queue object,
+ *                     wait for given duration of time while the priority queue object is full
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *   data            : pointer to mail data
+ *   prio            : priority of the mail (the higher value, the higher priority)
+ *   delay           : duration of time (maximum number of ticks to wait while the priority queue object is full)
+ *                     IMMEDIATE: don't wait if the priority queue object is full
+ *                     INFINITE:  wait indefinitely while the priority queue object is full
+ *
+ * Return
+ *   E_SUCCESS       : mail data was successfully transferred to the priority queue object
+ *   E_STOPPED       : priority queue object was reseted before the specified timeout expired
+ *   E_DELETED       : priority queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : priority queue object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int prq_sendFor( prq_t *prq, const void *data, unsigned prio, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : prq_sendUntil
+ *
+ * Description       : try to transfer mail data with given priority to the priority queue object,
+ *                     wait until given timepoint while the priority queue object is full
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *   data            : pointer to mail data
+ *   prio            : priority of the mail (the higher value, the higher priority)
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : mail data was successfully transferred to the priority queue object
+ *   E_STOPPED       : priority queue object was reseted before the specified timeout expired
+ *   E_DELETED       : priority queue object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : priority queue object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int prq_sendUntil( prq_t *prq, const void *data, unsigned prio, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : prq_send
+ *
+ * Description       : try to transfer mail data with given priority to the priority queue object,
+ *                     wait indefinitely while the priority queue object is full
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *   data            : pointer to mail data
+ *   prio            : priority of the mail (the higher value, the higher priority)
+ *
+ * Return
+ *   E_SUCCESS       : mail data was successfully transferred to the priority queue object
+ *   E_STOPPED       : priority queue object was reseted
+ *   E_DELETED       : priority queue object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int prq_send( prq_t *prq, const void *data, unsigned prio ) { return prq_sendFor(prq, data, prio, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : prq_count
+ * ISR alias         : prq_countISR
+ *
+ * Description       : return the number of mails in the priority queue
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *
+ * Return            : number of mails in the priority queue
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned prq_count( prq_t *prq );
+
+__STATIC_INLINE
+unsigned prq_countISR( prq_t *prq ) { return prq_count(prq); }
+
+/******************************************************************************
+ *
+ * Name              : prq_space
+ * ISR alias         : prq_spaceISR
+ *
+ * Description       : return the number of free slots in the priority queue
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *
+ * Return            : number of free slots in the priority queue
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned prq_space( prq_t *prq );
+
+__STATIC_INLINE
+unsigned prq_spaceISR( prq_t *prq ) { return prq_space(prq); }
+
+/******************************************************************************
+ *
+ * Name              : prq_limit
+ * ISR alias         : prq_limitISR
+ *
+ * Description       : return the size of the priority queue
+ *
+ * Parameters
+ *   prq             : pointer to priority queue object
+ *
+ * Return            : size of the priority queue
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned prq_limit( prq_t *prq );
+
+__STATIC_INLINE
+unsigned prq_limitISR( prq_t *prq ) { return prq_limit(prq); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+namespace stateos {
+
+/******************************************************************************
+ *
+ * Class             : PriorityQueueT<>
+ *
+ * Description       : create and initialize a priority queue object
+ *
+ * Constructor parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   size            : size of a single mail (in bytes)
+ *
+ ******************************************************************************/
+
+template<unsigned limit_, size_t size_>
+struct PriorityQueueT : public __prq
+{
+	constexpr
+	PriorityQueueT( void ): __prq _PRQ_INIT(limit_, size_, node_, data_) {}
+
+	PriorityQueueT( PriorityQueueT&& ) = default;
+	PriorityQueueT( const PriorityQueueT& ) = delete;
+	PriorityQueueT& operator=( PriorityQueueT&& ) = delete;
+	PriorityQueueT& operator=( const PriorityQueueT& ) = delete;
+
+	~PriorityQueueT( void ) { assert(__prq::obj.queue == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<PriorityQueueT<limit_, size_>>;
+#else
+	using Ptr = PriorityQueueT<limit_, size_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : PriorityQueueT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   size            : size of a single mail (in bytes)
+ *
+ * Return            : std::unique_pointer / pointer to PriorityQueueT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto prq = new PriorityQueueT<limit_, size_>();
+		if (prq != nullptr)
+			prq->__prq::obj.res = prq;
+		return Ptr(prq);
+	}
+
+	void     reset    (       void )                                        {        prq_reset    (this); }
+	void     kill     (       void )                                        {        prq_kill     (this); }
+	void     destroy  (       void )                                        {        prq_destroy  (this); }
+	int      take     (       void *_data, unsigned *_prio = nullptr )      { return prq_take     (this, _data, _prio); }
+	int      tryWait  (       void *_data, unsigned *_prio = nullptr )      { return prq_tryWait  (this, _data, _prio); }
+	int      takeISR  (       void *_data, unsigned *_prio = nullptr )      { return prq_takeISR  (this, _data, _prio); }
+	template<typename T>
+	int      waitFor  (       void *_data, unsigned *_prio, const T _delay ){ return prq_waitFor  (this, _data, _prio, Clock::count(_delay)); }
+	template<typename T>
+	int      waitUntil(       void *_data, unsigned *_prio, const T _time ) { return prq_waitUntil(this, _data, _prio, Clock::until(_time)); }
+	int      wait     (       void *_data, unsigned *_prio = nullptr )      { return prq_wait     (this, _data, _prio); }
+	int      give     ( const void *_data, unsigned  _prio )                { return prq_give     (this, _data, _prio); }
+	int      giveISR  ( const void *_data, unsigned  _prio )                { return prq_giveISR  (this, _data, _prio); }
+	template<typename T>
+	int      sendFor  ( const void *_data, unsigned  _prio, const T _delay ){ return prq_sendFor  (this, _data, _prio, Clock::count(_delay)); }
+	template<typename T>
+	int      sendUntil( const void *_data, unsigned  _prio, const T _time ) { return prq_sendUntil(this, _data, _prio, Clock::until(_time)); }
+	int      send     ( const void *_data, unsigned  _prio )                { return prq_send     (this, _data, _prio); }
+	unsigned count    (       void )                                        { return prq_count    (this); }
+	unsigned countISR (       void )                                        { return prq_countISR (this); }
+	unsigned space    (       void )                                        { return prq_space    (this); }
+	unsigned spaceISR (       void )                                        { return prq_spaceISR (this); }
+	unsigned limit    (       void )                                        { return prq_limit    (this); }
+	unsigned limitISR (       void )                                        { return prq_limitISR (this); }
+
+	private:
+	prn_t node_[limit_];
+	char  data_[limit_ * size_];
+};
+
+/******************************************************************************
+ *
+ * Class             : PriorityQueueTT<>
+ *
+ * Description       : create and initialize a priority queue object
+ *
+ * Constructor parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   C               : class of a single mail
+ *
+ ******************************************************************************/
+
+template<unsigned limit_, class C>
+struct PriorityQueueTT : public PriorityQueueT<limit_, sizeof(C)>
+{
+	constexpr
+	PriorityQueueTT( void ): PriorityQueueT<limit_, sizeof(C)>() {}
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<PriorityQueueTT<limit_, C>>;
+#else
+	using Ptr = PriorityQueueTT<limit_, C> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : PriorityQueueTT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of stored mails)
+ *   C               : class of a single mail
+ *
+ * Return            : std::unique_pointer / pointer to PriorityQueueTT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto prq = new PriorityQueueTT<limit_, C>();
+		if (prq != nullptr)
+			prq->__prq::obj.res = prq;
+		return Ptr(prq);
+	}
+};
+
+}     //  namespace
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_PRQ_H
@@ -0,0 +1,774 @@
+/******************************************************************************
+
+    @file    StateOS: osringbuffer.h
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_RBF_H
+#define __STATEOS_RBF_H
+
+#include "oskernel.h"
+#include "osclock.h"
+
+#if OS_ATOMICS
+
+/******************************************************************************
+ *
+ * Name              : ring buffer
+ *
+ ******************************************************************************/
+
+typedef struct __rbf rbf_t, * const rbf_id;
+
+struct __rbf
+{
+	obj_t    obj;   // object header
+
+	unsigned head;  // position of the first element to read, updated only by the consumer (atomic)
+	unsigned tail;  // position of the first element to write, updated only by the producer (atomic)
+	unsigned wait;  // the consumer or the producer is waiting on the ring buffer (atomic)
+
+	unsigned limit; // size of the ring buffer (max number of stored elements)
+	size_t   size;  // size of a single element (in bytes)
+	char   * data;  // data buffer
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _RBF_INIT
+ *
+ * Description       : create and initialize a ring buffer object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored elements)
+ *   size            : size of a single element (in bytes)
+ *   data            : ring buffer data buffer
+ *
+ * Return            : ring buffer object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _RBF_INIT( _limit, _size, _data ) { _OBJ_INIT(), 0, 0, 0, _limit, _size, _data }
+
+/******************************************************************************
+ *
+ * Name              : _RBF_DATA
+ *
+ * Description       : create a ring buffer data buffer
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored elements)
+ *   size            : size of a single element (in bytes)
+ *
+ * Return            : ring buffer data buffer
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _RBF_DATA( _limit, _size ) (char[_limit * _size]){ 0 }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : OS_RBF
+ *
+ * Description       : define and initialize a ring buffer object
+ *
+ * Parameters
+ *   rbf             : name of a pointer to ring buffer object
+ *   limit           : size of a buffer (max number of stored elements)
+ *   size            : size of a single element (in bytes), 1 for a byte stream
+ *
+ ******************************************************************************/
+
+#define             OS_RBF( rbf, limit, size )                                \
+                       char rbf##__buf[limit * size];                          \
+                       rbf_t rbf##__rbf = _RBF_INIT( limit, size, rbf##__buf ); \
+                       rbf_id rbf = & rbf##__rbf
+
+/******************************************************************************
+ *
+ * Name              : static_RBF
+ *
+ * Description       : define and initialize a static ring buffer object
+ *
+ * Parameters
+ *   rbf             : name of a pointer to ring buffer object
+ *   limit           : size of a buffer (max number of stored elements)
+ *   size            : size of a single element (in bytes), 1 for a byte stream
+ *
+ ******************************************************************************/
+
+#define         static_RBF( rbf, limit, size )                                \
+                static char rbf##__buf[limit * size];                          \
+                static rbf_t rbf##__rbf = _RBF_INIT( limit, size, rbf##__buf ); \
+                static rbf_id rbf = & rbf##__rbf
+
+/******************************************************************************
+ *
+ * Name              : RBF_INIT
+ *
+ * Description       : create and initialize a ring buffer object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored elements)
+ *   size            : size of a single element (in bytes), 1 for a byte stream
+ *
+ * Return            : ring buffer object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                RBF_INIT( limit, size ) \
+                      _RBF_INIT( limit, size, _RBF_DATA( limit, size ) )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : RBF_CREATE
+ * Alias             : RBF_NEW
+ *
+ * Description       : create and initialize a ring buffer object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored elements)
+ *   size            : size of a single element (in bytes), 1 for a byte stream
+ *
+ * Return            : pointer to ring buffer object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                RBF_CREATE( limit, size ) \
+           (rbf_t[]) { RBF_INIT  ( limit, size ) }
+#define                RBF_NEW \
+                       RBF_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : rbf_init
+ *
+ * Description       : initialize a ring buffer object
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   size            : size of a single element (in bytes), 1 for a byte stream
+ *   data            : ring buffer data buffer
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void rbf_init( rbf_t *rbf, size_t size, void *data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : rbf_create
+ * Alias             : rbf_new
+ *
+ * Description       : create and initialize a new ring buffer object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored elements)
+ *   size            : size of a single element (in bytes), 1 for a byte stream
+ *
+ * Return            : pointer to ring buffer object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+rbf_t *rbf_create( unsigned limit, size_t size );
+
+__STATIC_INLINE
+rbf_t *rbf_new( unsigned limit, size_t size ) { return rbf_create(limit, size); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_reset
+ * Alias             : rbf_kill
+ *
+ * Description       : reset the ring buffer object and wake up the waiting task with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     neither the producer nor the consumer may use the ring buffer during the reset
+ *
+ ******************************************************************************/
+
+void rbf_reset( rbf_t *rbf );
+
+__STATIC_INLINE
+void rbf_kill( rbf_t *rbf ) { rbf_reset(rbf); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_destroy
+ * Alias             : rbf_delete
+ *
+ * Description       : reset the ring buffer object, wake up the waiting task with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     neither the producer nor the consumer may use the ring buffer during the destruction
+ *
+ ******************************************************************************/
+
+void rbf_destroy( rbf_t *rbf );
+
+__STATIC_INLINE
+void rbf_delete( rbf_t *rbf ) { rbf_destroy(rbf); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_take
+ * Alias             : rbf_tryWait
+ * ISR alias         : rbf_takeISR
+ *
+ * Description       : try to transfer an element from the ring buffer object,
+ *                     don't wait if the ring buffer object is empty
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to store the element
+ *
+ * Return
+ *   E_SUCCESS       : element was successfully transferred from the ring buffer object
+ *   E_TIMEOUT       : ring buffer object is empty, try again
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     without locking, the ring buffer must have only one consumer
+ *                     wakes up the producer if it is waiting for free space (blockable interrupts only)
+ *
+ ******************************************************************************/
+
+int rbf_take( rbf_t *rbf, void *data );
+
+__STATIC_INLINE
+int rbf_tryWait( rbf_t *rbf, void *data ) { return rbf_take(rbf, data); }
+
+__STATIC_INLINE
+int rbf_takeISR( rbf_t *rbf, void *data ) { return rbf_take(rbf, data); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_waitFor
+ *
+ * Description       : try to transfer an element from the ring buffer object,
+ *                     wait for given duration of time while the ring buffer object is empty
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to store the element
+ *   delay           : duration of time (maximum number of ticks to wait while the ring buffer object is empty)
+ *                     IMMEDIATE: don't wait if the ring buffer object is empty
+ *                     INFINITE:  wait indefinitely while the ring buffer object is empty
+ *
+ * Return
+ *   E_SUCCESS       : element was successfully transferred from the ring buffer object
+ *   E_STOPPED       : ring buffer object was reseted before the specified timeout expired
+ *   E_DELETED       : ring buffer object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : ring buffer object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the ring buffer must have only one consumer
+ *
+ ******************************************************************************/
+
+int rbf_waitFor( rbf_t *rbf, void *data, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : rbf_waitUntil
+ *
+ * Description       : try to transfer an element from the ring buffer object,
+ *                     wait until given timepoint while the ring buffer object is empty
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to store the element
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : element was successfully transferred from the ring buffer object
+ *   E_STOPPED       : ring buffer object was reseted before the specified timeout expired
+ *   E_DELETED       : ring buffer object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : ring buffer object is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the ring buffer must have only one consumer
+ *
+ ******************************************************************************/
+
+int rbf_waitUntil( rbf_t *rbf, void *data, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : rbf_wait
+ *
+ * Description       : try to transfer an element from the ring buffer object,
+ *                     wait indefinitely while the ring buffer object is empty
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to store the element
+ *
+ * Return
+ *   E_SUCCESS       : element was successfully transferred from the ring buffer object
+ *   E_STOPPED       : ring buffer object was reseted
+ *   E_DELETED       : ring buffer object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     the ring buffer must have only one consumer
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int rbf_wait( rbf_t *rbf, void *data ) { return rbf_waitFor(rbf, data, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_give
+ * ISR alias         : rbf_giveISR
+ *
+ * Description       : try to transfer an element to the ring buffer object,
+ *                     don't wait if the ring buffer object is full
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to the element
+ *
+ * Return
+ *   E_SUCCESS       : element was successfully transferred to the ring buffer object
+ *   E_TIMEOUT       : ring buffer object is full, try again
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     without locking, the ring buffer must have only one producer
+ *                     wakes up the consumer if it is waiting for data (blockable interrupts only)
+ *
+ ******************************************************************************/
+
+int rbf_give( rbf_t *rbf, const void *data );
+
+__STATIC_INLINE
+int rbf_giveISR( rbf_t *rbf, const void *data ) { return rbf_give(rbf, data); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_sendFor
+ *
+ * Description       : try to transfer an element to the ring buffer object,
+ *                     wait for given duration of time while the ring buffer object is full
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to the element
+ *   delay           : duration of time (maximum number of ticks to wait while the ring buffer object is full)
+ *                     IMMEDIATE: don't wait if the ring buffer object is full
+ *                     INFINITE:  wait indefinitely while the ring buffer object is full
+ *
+ * Return
+ *   E_SUCCESS       : element was successfully transferred to the ring buffer object
+ *   E_STOPPED       : ring buffer object was reseted before the specified timeout expired
+ *   E_DELETED       : ring buffer object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : ring buffer object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the ring buffer must have only one producer
+ *
+ ******************************************************************************/
+
+int rbf_sendFor( rbf_t *rbf, const void *data, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : rbf_sendUntil
+ *
+ * Description       : try to transfer an element to the ring buffer object,
+ *                     wait until given timepoint while the ring buffer object is full
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to the element
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : element was successfully transferred to the ring buffer object
+ *   E_STOPPED       : ring buffer object was reseted before the specified timeout expired
+ *   E_DELETED       : ring buffer object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : ring buffer object is full and was not issued data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the ring buffer must have only one producer
+ *
+ ******************************************************************************/
+
+int rbf_sendUntil( rbf_t *rbf, const void *data, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : rbf_send
+ *
+ * Description       : try to transfer an element to the ring buffer object,
+ *                     wait indefinitely while the ring buffer object is full
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to the element
+ *
+ * Return
+ *   E_SUCCESS       : element was successfully transferred to the ring buffer object
+ *   E_STOPPED       : ring buffer object was reseted
+ *   E_DELETED       : ring buffer object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     the ring buffer must have only one producer
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int rbf_send( rbf_t *rbf, const void *data ) { return rbf_sendFor(rbf, data, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_read
+ * ISR alias         : rbf_readISR
+ *
+ * Description       : transfer as many elements as possible (but not more than given number) from the ring buffer object,
+ *                     don't wait if the ring buffer object is empty
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to the buffer for the elements
+ *   count           : max number of elements to transfer
+ *
+ * Return            : number of transferred elements
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     without locking, the ring buffer must have only one consumer
+ *                     wakes up the producer if it is waiting for free space (blockable interrupts only)
+ *
+ ******************************************************************************/
+
+unsigned rbf_read( rbf_t *rbf, void *data, unsigned count );
+
+__STATIC_INLINE
+unsigned rbf_readISR( rbf_t *rbf, void *data, unsigned count ) { return rbf_read(rbf, data, count); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_write
+ * ISR alias         : rbf_writeISR
+ *
+ * Description       : transfer as many elements as possible (but not more than given number) to the ring buffer object,
+ *                     don't wait if the ring buffer object is full
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *   data            : pointer to the elements
+ *   count           : max number of elements to transfer
+ *
+ * Return            : number of transferred elements
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     without locking, the ring buffer must have only one producer
+ *                     wakes up the consumer if it is waiting for data (blockable interrupts only)
+ *
+ ******************************************************************************/
+
+unsigned rbf_write( rbf_t *rbf, const void *data, unsigned count );
+
+__STATIC_INLINE
+unsigned rbf_writeISR( rbf_t *rbf, const void *data, unsigned count ) { return rbf_write(rbf, data, count); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_count
+ * ISR alias         : rbf_countISR
+ *
+ * Description       : return the number of elements in the ring buffer
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *
+ * Return            : number of elements in the ring buffer
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     the value may be outdated if the producer or the consumer is active
+ *
+ ******************************************************************************/
+
+unsigned rbf_count( rbf_t *rbf );
+
+__STATIC_INLINE
+unsigned rbf_countISR( rbf_t *rbf ) { return rbf_count(rbf); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_space
+ * ISR alias         : rbf_spaceISR
+ *
+ * Description       : return the number of free elements in the ring buffer
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *
+ * Return            : number of free elements in the ring buffer
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     the value may be outdated if the producer or the consumer is active
+ *
+ ******************************************************************************/
+
+unsigned rbf_space( rbf_t *rbf );
+
+__STATIC_INLINE
+unsigned rbf_spaceISR( rbf_t *rbf ) { return rbf_space(rbf); }
+
+/******************************************************************************
+ *
+ * Name              : rbf_limit
+ * ISR alias         : rbf_limitISR
+ *
+ * Description       : return the size of the ring buffer
+ *
+ * Parameters
+ *   rbf             : pointer to ring buffer object
+ *
+ * Return            : size of the ring buffer
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     the value may be outdated if the producer or the consumer is active
+ *
+ ******************************************************************************/
+
+unsigned rbf_limit( rbf_t *rbf );
+
+__STATIC_INLINE
+unsigned rbf_limitISR( rbf_t *rbf ) { return rbf_limit(rbf); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+namespace stateos {
+
+/******************************************************************************
+ *
+ * Class             : RingBufferT<>
+ *
+ * Description       : create and initialize a ring buffer object
+ *
+ * Constructor parameters
+ *   limit           : size of a buffer (max number of stored elements)
+ *   size            : size of a single element (in bytes), 1 for a byte stream
+ *
+ ******************************************************************************/
+
+template<unsigned limit_, size_t size_ = 1>
+struct RingBufferT : public __rbf
+{
+	constexpr
+	RingBufferT( void ): __rbf _RBF_INIT(limit_, size_, data_) {}
+
+	RingBufferT( RingBufferT&& ) = default;
+	RingBufferT( const RingBufferT& ) = delete;
+	RingBufferT& operator=( RingBufferT&& ) = delete;
+	RingBufferT& operator=( const RingBufferT& ) = delete;
+
+	~RingBufferT( void ) { assert(__rbf::obj.queue == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<RingBufferT<limit_, size_>>;
+#else
+	using Ptr = RingBufferT<limit_, size_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : RingBufferT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored elements)
+ *   size            : size of a single element (in bytes), 1 for a byte stream
+ *
+ * Return            : std::unique_pointer / pointer to RingBufferT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto rbf = new RingBufferT<limit_, size_>();
+		if (rbf != nullptr)
+			rbf->__rbf::obj.res = rbf;
+		return Ptr(rbf);
+	}
+
+	void     reset    (       void )                         {        rbf_reset    (this); }
+	void     kill     (       void )                         {        rbf_kill     (this); }
+	void     destroy  (       void )                         {        rbf_destroy  (this); }
+	int      take     (       void *_data )                  { return rbf_take     (this, _data); }
+	int      tryWait  (       void *_data )                  { return rbf_tryWait  (this, _data); }
+	int      takeISR  (       void *_data )                  { return rbf_takeISR  (this, _data); }
+	template<typename T>
+	int      waitFor  (       void *_data, const T _delay )  { return rbf_waitFor  (this, _data, Clock::count(_delay)); }
+	template<typename T>
+	int      waitUntil(       void *_data, const T _time )   { return rbf_waitUntil(this, _data, Clock::until(_time)); }
+	int      wait     (       void *_data )                  { return rbf_wait     (this, _data); }
+	int      give     ( const void *_data )                  { return rbf_give     (this, _data); }
+	int      giveISR  ( const void *_data )                  { return rbf_giveISR  (this, _data); }
+	template<typename T>
+	int      sendFor  ( const void *_data, const T _delay )  { return rbf_sendFor  (this, _data, Clock::count(_delay)); }
+	template<typename T>
+	int      sendUntil( const void *_data, const T _time )   { return rbf_sendUntil(this, _data, Clock::until(_time)); }
+	int      send     ( const void *_data )                  { return rbf_send     (this, _data); }
+	unsigned read     (       void *_data, unsigned _count ) { return rbf_read     (this, _data, _count); }
+	unsigned readISR  (       void *_data, unsigned _count ) { return rbf_readISR  (this, _data, _count); }
+	unsigned write    ( const void *_data, unsigned _count ) { return rbf_write    (this, _data, _count); }
+	unsigned writeISR ( const void *_data, unsigned _count ) { return rbf_writeISR (this, _data, _count); }
+	unsigned count    (       void )                         { return rbf_count    (this); }
+	unsigned countISR (       void )                         { return rbf_countISR (this); }
+	unsigned space    (       void )                         { return rbf_space    (this); }
+	unsigned spaceISR (       void )                         { return rbf_spaceISR (this); }
+	unsigned limit    (       void )                         { return rbf_limit    (this); }
+	unsigned limitISR (       void )                         { return rbf_limitISR (this); }
+
+	private:
+	char data_[limit_ * size_];
+};
+
+/******************************************************************************
+ *
+ * Class             : RingBufferTT<>
+ *
+ * Description       : create and initialize a ring buffer object
+ *
+ * Constructor parameters
+ *   limit           : size of a buffer (max number of stored elements)
+ *   C               : class of a single element
+ *
+ ******************************************************************************/
+
+template<unsigned limit_, class C>
+struct RingBufferTT : public RingBufferT<limit_, sizeof(C)>
+{
+	constexpr
+	RingBufferTT( void ): RingBufferT<limit_, sizeof(C)>() {}
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<RingBufferTT<limit_, C>>;
+#else
+	using Ptr = RingBufferTT<limit_, C> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : RingBufferTT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of stored elements)
+ *   C               : class of a single element
+ *
+ * Return            : std::unique_pointer / pointer to RingBufferTT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto rbf = new RingBufferTT<limit_, C>();
+		if (rbf != nullptr)
+			rbf->__rbf::obj.res = rbf;
+		return Ptr(rbf);
+	}
+
+	int      take     (       C *_data )                  { return rbf_take     (this, _data); }
+	int      takeISR  (       C *_data )                  { return rbf_takeISR  (this, _data); }
+	template<typename T>
+	int      waitFor  (       C *_data, const T _delay )  { return rbf_waitFor  (this, _data, Clock::count(_delay)); }
+	template<typename T>
+	int      waitUntil(       C *_data, const T _time )   { return rbf_waitUntil(this, _data, Clock::until(_time)); }
+	int      wait     (       C *_data )                  { return rbf_wait     (this, _data); }
+	int      give     ( const C *_data )                  { return rbf_give     (this, _data); }
+	int      giveISR  ( const C *_data )                  { return rbf_giveISR  (this, _data); }
+	template<typename T>
+	int      sendFor  ( const C *_data, const T _delay )  { return rbf_sendFor  (this, _data, Clock::count(_delay)); }
+	template<typename T>
+	int      sendUntil( const C *_data, const T _time )   { return rbf_sendUntil(this, _data, Clock::until(_time)); }
+	int      send     ( const C *_data )                  { return rbf_send     (this, _data); }
+	unsigned read     (       C *_data, unsigned _count ) { return rbf_read     (this, _data, _count); }
+	unsigned readISR  (       C *_data, unsigned _count ) { return rbf_readISR  (this, _data, _count); }
+	unsigned write    ( const C *_data, unsigned _count ) { return rbf_write    (this, _data, _count); }
+	unsigned writeISR ( const C *_data, unsigned _count ) { return rbf_writeISR (this, _data, _count); }
+};
+
+}     //  namespace
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_ATOMICS
+
+#endif//__STATEOS_RBF_H
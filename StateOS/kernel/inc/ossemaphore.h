@@ -394,6 +394,31 @@ int sem_wait( sem_t *sem ) { return sem_waitFor(sem, INFINITE); }
 int sem_waitAsync( sem_t *sem );
 #endif
 
+/******************************************************************************
+ *
+ * Name              : sem_takeN
+ * ISR alias         : sem_takeNISR
+ *
+ * Description       : try to lock the semaphore object as many times as possible (but not more than given number),
+ *                     don't wait if the semaphore object can't be locked immediately
+ *
+ * Parameters
+ *   sem             : pointer to semaphore object
+ *   num             : max number of locks
+ *
+ * Return            : number of successful locks of the semaphore object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the semaphore object is locked in a single critical section
+ *
+ ******************************************************************************/
+
+unsigned sem_takeN( sem_t *sem, unsigned num );
+
+__STATIC_INLINE
+unsigned sem_takeNISR( sem_t *sem, unsigned num ) { return sem_takeN(sem, num); }
+
 /******************************************************************************
  *
  * Name              : sem_give
@@ -414,6 +439,9 @@ int sem_waitAsync( sem_t *sem );
  * Note              : can be used in both thread and handler mode
  *                     use ISR alias in blockable interrupt handlers
  *                     use Async alias for communication with unmasked interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue:
+ *                     E_SUCCESS means the request was queued, a full semaphore object is never reported,
+ *                     E_TIMEOUT means the deferred services queue is full and the request was dropped
  *
  ******************************************************************************/
 
@@ -422,13 +450,42 @@ int sem_give( sem_t *sem );
 __STATIC_INLINE
 int sem_post( sem_t *sem ) { return sem_give(sem); }
 
+#if OS_DEFER_SIZE
+int sem_giveISR( sem_t *sem );
+#else
 __STATIC_INLINE
 int sem_giveISR( sem_t *sem ) { return sem_give(sem); }
+#endif
 
 #if OS_ATOMICS
 int sem_giveAsync( sem_t *sem );
 #endif
 
+/******************************************************************************
+ *
+ * Name              : sem_giveN
+ * ISR alias         : sem_giveNISR
+ *
+ * Description       : try to unlock the semaphore object as many times as possible (but not more than given number),
+ *                     wake up waiting tasks first, then increase the value of the semaphore up to its limit
+ *
+ * Parameters
+ *   sem             : pointer to semaphore object
+ *   num             : max number of unlocks
+ *
+ * Return            : number of successful unlocks of the semaphore object
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the semaphore object is unlocked in a single critical section
+ *
+ ******************************************************************************/
+
+unsigned sem_giveN( sem_t *sem, unsigned num );
+
+__STATIC_INLINE
+unsigned sem_giveNISR( sem_t *sem, unsigned num ) { return sem_giveN(sem, num); }
+
 /******************************************************************************
  *
  * Name              : sem_getValue
@@ -583,6 +640,10 @@ struct Semaphore : public __sem
 	int      give     ( void )           { return sem_give     (this); }
 	int      post     ( void )           { return sem_post     (this); }
 	int      giveISR  ( void )           { return sem_giveISR  (this); }
+	unsigned takeN    ( unsigned _num )  { return sem_takeN    (this, _num); }
+	unsigned takeNISR ( unsigned _num )  { return sem_takeNISR (this, _num); }
+	unsigned giveN    ( unsigned _num )  { return sem_giveN    (this, _num); }
+	unsigned giveNISR ( unsigned _num )  { return sem_giveNISR (this, _num); }
 	unsigned getValue ( void )           { return sem_getValue (this); }
 #if OS_ATOMICS
 	int      takeAsync( void )           { return sem_takeAsync(this); }
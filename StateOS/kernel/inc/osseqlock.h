@@ -0,0 +1,516 @@
+/******************************************************************************
+
+    @file    StateOS: osseqlock.h
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#ifndef __STATEOS_SEQ_H
+#define __STATEOS_SEQ_H
+
+#include "oskernel.h"
+
+#if OS_ATOMICS
+
+/* -------------------------------------------------------------------------- */
+
+#define seqSingle    ( 1U )   // sequence lock, readers retry while the data is being updated
+#define seqDouble    ( 2U )   // double buffered sequence lock, readers always get the last complete data
+#define seqDefault     seqSingle
+
+/******************************************************************************
+ *
+ * Name              : sequence lock
+ *
+ ******************************************************************************/
+
+typedef struct __seq seq_t, * const seq_id;
+
+struct __seq
+{
+	obj_t    obj;   // object header
+
+	unsigned count; // sequence counter, odd while the writer updates the data (atomic)
+	unsigned limit; // number of data buffers (seqSingle, seqDouble)
+	size_t   size;  // size of the data (in bytes)
+	char   * data;  // data buffer(s)
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _SEQ_INIT
+ *
+ * Description       : create and initialize a sequence lock object
+ *
+ * Parameters
+ *   limit           : number of data buffers (seqSingle, seqDouble)
+ *   size            : size of the data (in bytes)
+ *   data            : sequence lock data buffer
+ *
+ * Return            : sequence lock object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _SEQ_INIT( _limit, _size, _data ) { _OBJ_INIT(), 0, _limit, _size, _data }
+
+/******************************************************************************
+ *
+ * Name              : _SEQ_DATA
+ *
+ * Description       : create a sequence lock data buffer
+ *
+ * Parameters
+ *   limit           : number of data buffers (seqSingle, seqDouble)
+ *   size            : size of the data (in bytes)
+ *
+ * Return            : sequence lock data buffer
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _SEQ_DATA( _limit, _size ) (char[_limit * _size]){ 0 }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _VA_SEQ
+ *
+ * Description       : calculate number of data buffers from optional parameter
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _VA_SEQ( _limit ) ( (_limit + 0) ? (_limit + 0) : (seqDefault) )
+
+/******************************************************************************
+ *
+ * Name              : OS_SEQ
+ *
+ * Description       : define and initialize a sequence lock object
+ *
+ * Parameters
+ *   seq             : name of a pointer to sequence lock object
+ *   size            : size of the data (in bytes)
+ *   limit           : (optional) number of data buffers
+ *                     seqSingle: sequence lock (default)
+ *                     seqDouble: double buffered sequence lock
+ *
+ ******************************************************************************/
+
+#define             OS_SEQ( seq, size, ... )                                                 \
+                       char seq##__buf[_VA_SEQ(__VA_ARGS__) * size];                          \
+                       seq_t seq##__seq = _SEQ_INIT( _VA_SEQ(__VA_ARGS__), size, seq##__buf ); \
+                       seq_id seq = & seq##__seq
+
+/******************************************************************************
+ *
+ * Name              : static_SEQ
+ *
+ * Description       : define and initialize a static sequence lock object
+ *
+ * Parameters
+ *   seq             : name of a pointer to sequence lock object
+ *   size            : size of the data (in bytes)
+ *   limit           : (optional) number of data buffers
+ *                     seqSingle: sequence lock (default)
+ *                     seqDouble: double buffered sequence lock
+ *
+ ******************************************************************************/
+
+#define         static_SEQ( seq, size, ... )                                                 \
+                static char seq##__buf[_VA_SEQ(__VA_ARGS__) * size];                          \
+                static seq_t seq##__seq = _SEQ_INIT( _VA_SEQ(__VA_ARGS__), size, seq##__buf ); \
+                static seq_id seq = & seq##__seq
+
+/******************************************************************************
+ *
+ * Name              : SEQ_INIT
+ *
+ * Description       : create and initialize a sequence lock object
+ *
+ * Parameters
+ *   size            : size of the data (in bytes)
+ *   limit           : (optional) number of data buffers
+ *                     seqSingle: sequence lock (default)
+ *                     seqDouble: double buffered sequence lock
+ *
+ * Return            : sequence lock object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                SEQ_INIT( size, ... ) \
+                      _SEQ_INIT( _VA_SEQ(__VA_ARGS__), size, _SEQ_DATA( _VA_SEQ(__VA_ARGS__), size ) )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : SEQ_CREATE
+ * Alias             : SEQ_NEW
+ *
+ * Description       : create and initialize a sequence lock object
+ *
+ * Parameters
+ *   size            : size of the data (in bytes)
+ *   limit           : (optional) number of data buffers
+ *                     seqSingle: sequence lock (default)
+ *                     seqDouble: double buffered sequence lock
+ *
+ * Return            : pointer to sequence lock object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                SEQ_CREATE( size, ... ) \
+           (seq_t[]) { SEQ_INIT  ( size, __VA_ARGS__ ) }
+#define                SEQ_NEW \
+                       SEQ_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : seq_init
+ *
+ * Description       : initialize a sequence lock object
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *   limit           : number of data buffers
+ *                     seqSingle: sequence lock
+ *                     seqDouble: double buffered sequence lock
+ *   data            : sequence lock data buffer
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     size of the data is equal to bufsize / limit
+ *
+ ******************************************************************************/
+
+void seq_init( seq_t *seq, unsigned limit, void *data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : seq_create
+ * Alias             : seq_new
+ *
+ * Description       : create and initialize a new sequence lock object
+ *
+ * Parameters
+ *   limit           : number of data buffers
+ *                     seqSingle: sequence lock
+ *                     seqDouble: double buffered sequence lock
+ *   size            : size of the data (in bytes)
+ *
+ * Return            : pointer to sequence lock object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+seq_t *seq_create( unsigned limit, size_t size );
+
+__STATIC_INLINE
+seq_t *seq_new( unsigned limit, size_t size ) { return seq_create(limit, size); }
+
+/******************************************************************************
+ *
+ * Name              : seq_destroy
+ * Alias             : seq_delete
+ *
+ * Description       : free allocated resource of the sequence lock object
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void seq_destroy( seq_t *seq );
+
+__STATIC_INLINE
+void seq_delete( seq_t *seq ) { seq_destroy(seq); }
+
+/******************************************************************************
+ *
+ * Name              : seq_read
+ * ISR alias         : seq_readISR
+ *
+ * Description       : copy consistent data from the sequence lock object,
+ *                     retry if the data was updated during the copy
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *   data            : pointer to the buffer receiving the data
+ *
+ * Return
+ *   E_SUCCESS       : consistent data was successfully copied
+ *   E_TIMEOUT       : the writer is updating the data of single buffered sequence lock, try again
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     never blocks and never masks interrupts
+ *                     a reader that preempted the writer of single buffered sequence lock cannot succeed
+ *                     until the writer resumes, double buffered sequence lock always returns E_SUCCESS
+ *
+ ******************************************************************************/
+
+int seq_read( seq_t *seq, void *data );
+
+__STATIC_INLINE
+int seq_readISR( seq_t *seq, void *data ) { return seq_read(seq, data); }
+
+/******************************************************************************
+ *
+ * Name              : seq_readBegin
+ *
+ * Description       : start reading the data of the sequence lock object in place
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *   data            : pointer to the variable getting the address of the data to read
+ *
+ * Return            : sequence value to be passed to seq_readRetry
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     the data read in place is valid only if seq_readRetry returns false
+ *
+ ******************************************************************************/
+
+unsigned seq_readBegin( seq_t *seq, const void **data );
+
+/******************************************************************************
+ *
+ * Name              : seq_readRetry
+ *
+ * Description       : check if the data read in place since seq_readBegin is consistent
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *   start           : sequence value returned by seq_readBegin
+ *
+ * Return
+ *   true            : the data was (or could be) modified, discard it and start reading again
+ *   false           : the data is consistent
+ *
+ * Note              : can be used in both thread and handler mode
+ *
+ ******************************************************************************/
+
+bool seq_readRetry( seq_t *seq, unsigned start );
+
+/******************************************************************************
+ *
+ * Name              : seq_write
+ * ISR alias         : seq_writeISR
+ *
+ * Description       : update the data of the sequence lock object
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *   data            : pointer to the new data
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     never blocks and never masks interrupts
+ *                     the sequence lock must have only one writer
+ *
+ ******************************************************************************/
+
+void seq_write( seq_t *seq, const void *data );
+
+__STATIC_INLINE
+void seq_writeISR( seq_t *seq, const void *data ) { seq_write(seq, data); }
+
+/******************************************************************************
+ *
+ * Name              : seq_writeBegin
+ *
+ * Description       : start updating the data of the sequence lock object in place
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *
+ * Return            : address of the data buffer to fill,
+ *                     for double buffered sequence lock the buffer contains the data written two updates ago
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     the update has to be completed with seq_writeEnd
+ *                     the sequence lock must have only one writer
+ *
+ ******************************************************************************/
+
+void *seq_writeBegin( seq_t *seq );
+
+/******************************************************************************
+ *
+ * Name              : seq_writeEnd
+ *
+ * Description       : complete updating the data of the sequence lock object started with seq_writeBegin
+ *
+ * Parameters
+ *   seq             : pointer to sequence lock object
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode
+ *
+ ******************************************************************************/
+
+void seq_writeEnd( seq_t *seq );
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+#include <type_traits>
+namespace stateos {
+
+/******************************************************************************
+ *
+ * Class             : Seqlock<>
+ *
+ * Description       : create and initialize a sequence lock object holding data of class T
+ *
+ * Constructor parameters
+ *   T               : class of the data (trivially copyable)
+ *   limit           : number of data buffers
+ *                     seqSingle: sequence lock (default)
+ *                     seqDouble: double buffered sequence lock
+ *   init            : (optional) initial value of the data
+ *
+ ******************************************************************************/
+
+template<class T, unsigned limit_ = seqDefault>
+struct Seqlock : public __seq
+{
+	static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+	constexpr
+	Seqlock( void ): __seq _SEQ_INIT(limit_, sizeof(T), data_) {}
+
+	explicit
+	Seqlock( const T& _init ): Seqlock() { for (unsigned i = 0; i < limit_; i++) memcpy(&data_[i * sizeof(T)], &_init, sizeof(T)); }
+
+	Seqlock( Seqlock&& ) = delete;
+	Seqlock( const Seqlock& ) = delete;
+	Seqlock& operator=( Seqlock&& ) = delete;
+	Seqlock& operator=( const Seqlock& ) = delete;
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<Seqlock<T, limit_>>;
+#else
+	using Ptr = Seqlock<T, limit_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : Seqlock<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   T               : class of the data (trivially copyable)
+ *   limit           : number of data buffers
+ *
+ * Return            : std::unique_pointer / pointer to Seqlock<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto seq = new Seqlock<T, limit_>();
+		if (seq != nullptr)
+			seq->__seq::obj.res = seq;
+		return Ptr(seq);
+	}
+
+/******************************************************************************
+ *
+ * Name              : Seqlock<>::load
+ *
+ * Description       : return consistent data of the sequence lock object,
+ *                     retry while the data is being updated
+ *
+ * Parameters        : none
+ *
+ * Return            : the data
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     a reader of single buffered sequence lock must not preempt the writer,
+ *                     use tryLoad or double buffered sequence lock in that case
+ *
+ ******************************************************************************/
+
+	T load( void )
+	{
+		T _data;
+		while (seq_read(this, &_data) != E_SUCCESS);
+		return _data;
+	}
+
+	int      tryLoad  (       T &_data ) { return seq_read     (this, &_data); }
+	void     store    ( const T &_data ) {        seq_write    (this, &_data); }
+	void     destroy  (       void )     {        seq_destroy  (this); }
+
+	private:
+	alignas(T) char data_[limit_ * sizeof(T)];
+};
+
+}     //  namespace
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_ATOMICS
+
+#endif//__STATEOS_SEQ_H
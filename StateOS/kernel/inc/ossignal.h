@@ -372,6 +372,8 @@ int sig_wait( sig_t *sig, unsigned sigset, unsigned *signo ) { return sig_waitFo
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue,
+ *                     the request is dropped if the deferred services queue is full (see sys_deferOverflow)
  *
  ******************************************************************************/
 
@@ -380,8 +382,12 @@ void sig_give( sig_t *sig, unsigned signo );
 __STATIC_INLINE
 void sig_set( sig_t *sig, unsigned signo ) { sig_give(sig, signo); }
 
+#if OS_DEFER_SIZE
+void sig_giveISR( sig_t *sig, unsigned signo );
+#else
 __STATIC_INLINE
 void sig_giveISR( sig_t *sig, unsigned signo ) { sig_give(sig, signo); }
+#endif
 
 /******************************************************************************
  *
@@ -383,6 +383,39 @@ int stm_waitUntil( stm_t *stm, void *data, size_t size, size_t *read, cnt_t time
 __STATIC_INLINE
 int stm_wait( stm_t *stm, void *data, size_t size, size_t *read ) { return stm_waitFor(stm, data, size, read, INFINITE); }
 
+/******************************************************************************
+ *
+ * Name              : stm_waitLevel
+ *
+ * Description       : try to transfer data from the stream buffer object,
+ *                     wait while the stream buffer object contains fewer than 'level' bytes;
+ *                     the idle timeout is restarted each time data arrives and when it expires
+ *                     the task receives the data available so far (like the uart fifo trigger level)
+ *
+ * Parameters
+ *   stm             : pointer to stream buffer object
+ *   data            : pointer to the buffer
+ *   size            : size of the buffer
+ *   read            : pointer to the variable getting number of read bytes
+ *   level           : trigger level (number of bytes that wakes up the task), limited to 'size'
+ *   idle            : idle timeout (maximum number of ticks to wait for the next data)
+ *                     IMMEDIATE: don't wait if the trigger level is not reached
+ *                     INFINITE:  wait indefinitely while the trigger level is not reached
+ *
+ * Return
+ *   E_SUCCESS       : variable 'read' contains the number of bytes read from the stream buffer
+ *   E_STOPPED       : stream buffer object was reseted before the idle timeout expired
+ *   E_DELETED       : stream buffer object was deleted before the idle timeout expired
+ *   E_TIMEOUT       : stream buffer object is empty and was not received data before the idle timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the task is woken once per block of data instead of once per byte
+ *                     waiting tasks get data regardless of their trigger levels when the buffer is full
+ *
+ ******************************************************************************/
+
+int stm_waitLevel( stm_t *stm, void *data, size_t size, size_t *read, size_t level, cnt_t idle );
+
 /******************************************************************************
  *
  * Name              : stm_give
@@ -517,6 +550,108 @@ int stm_push( stm_t *stm, const void *data, size_t size );
 __STATIC_INLINE
 int stm_pushISR( stm_t *stm, const void *data, size_t size ) { return stm_push(stm, data, size); }
 
+/******************************************************************************
+ *
+ * Name              : stm_reserve
+ * ISR alias         : stm_reserveISR
+ *
+ * Description       : get a contiguous region of free space in the stream buffer object,
+ *                     the producer can write data directly to the region and then commit it with stm_commit
+ *
+ * Parameters
+ *   stm             : pointer to stream buffer object
+ *   size            : pointer to the variable getting the size of the reserved region
+ *
+ * Return            : pointer to the beginning of the reserved region
+ *   NULL            : there is no free space in the stream buffer or other tasks are waiting to send data
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the region can be smaller than stm_space, when the free space wraps around the end of the buffer
+ *                     the stream buffer must have only one producer while the region is reserved
+ *
+ ******************************************************************************/
+
+void *stm_reserve( stm_t *stm, size_t *size );
+
+__STATIC_INLINE
+void *stm_reserveISR( stm_t *stm, size_t *size ) { return stm_reserve(stm, size); }
+
+/******************************************************************************
+ *
+ * Name              : stm_commit
+ * ISR alias         : stm_commitISR
+ *
+ * Description       : add data written to the region reserved with stm_reserve to the stream buffer object,
+ *                     resume tasks waiting to receive data
+ *
+ * Parameters
+ *   stm             : pointer to stream buffer object
+ *   size            : amount of data written to the reserved region (not greater than the size of the region)
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+void stm_commit( stm_t *stm, size_t size );
+
+__STATIC_INLINE
+void stm_commitISR( stm_t *stm, size_t size ) { stm_commit(stm, size); }
+
+/******************************************************************************
+ *
+ * Name              : stm_peek
+ * ISR alias         : stm_peekISR
+ *
+ * Description       : get a contiguous region of data contained in the stream buffer object,
+ *                     the consumer can read data directly from the region and then release it with stm_consume
+ *
+ * Parameters
+ *   stm             : pointer to stream buffer object
+ *   size            : pointer to the variable getting the size of the region
+ *
+ * Return            : pointer to the beginning of the region
+ *   NULL            : the stream buffer is empty
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the region can be smaller than stm_count, when the data wraps around the end of the buffer
+ *                     the stream buffer must have only one consumer while the region is in use
+ *
+ ******************************************************************************/
+
+const void *stm_peek( stm_t *stm, size_t *size );
+
+__STATIC_INLINE
+const void *stm_peekISR( stm_t *stm, size_t *size ) { return stm_peek(stm, size); }
+
+/******************************************************************************
+ *
+ * Name              : stm_consume
+ * ISR alias         : stm_consumeISR
+ *
+ * Description       : remove data read from the region returned by stm_peek from the stream buffer object,
+ *                     resume tasks waiting to send data
+ *
+ * Parameters
+ *   stm             : pointer to stream buffer object
+ *   size            : amount of data to remove (not greater than the amount of data contained in the stream buffer)
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+void stm_consume( stm_t *stm, size_t size );
+
+__STATIC_INLINE
+void stm_consumeISR( stm_t *stm, size_t size ) { stm_consume(stm, size); }
+
 /******************************************************************************
  *
  * Name              : stm_count
@@ -590,6 +725,9 @@ size_t stm_limitISR( stm_t *stm ) { return stm_limit(stm); }
 /* -------------------------------------------------------------------------- */
 
 #ifdef __cplusplus
+#if __cplusplus >= 202002
+#include <span>
+#endif
 namespace stateos {
 
 /******************************************************************************
@@ -657,6 +795,8 @@ struct StreamBufferT : public __stm
 	template<typename T>
 	int    waitUntil(       void *_data, size_t _size, size_t *_read,  const T _time )  { return stm_waitUntil(this, _data, _size, _read, _time); }
 	int    wait     (       void *_data, size_t _size, size_t *_read = nullptr )        { return stm_wait     (this, _data, _size, _read); }
+	template<typename T>
+	int    waitLevel(       void *_data, size_t _size, size_t *_read,  size_t _level, const T _idle ) { return stm_waitLevel(this, _data, _size, _read, _level, Clock::count(_idle)); }
 	int    give     ( const void *_data, size_t _size )                                 { return stm_give     (this, _data, _size); }
 	int    giveISR  ( const void *_data, size_t _size )                                 { return stm_giveISR  (this, _data, _size); }
 	template<typename T>
@@ -666,6 +806,26 @@ struct StreamBufferT : public __stm
 	int    send     ( const void *_data, size_t _size )                                 { return stm_send     (this, _data, _size); }
 	int    push     ( const void *_data, size_t _size )                                 { return stm_push     (this, _data, _size); }
 	int    pushISR  ( const void *_data, size_t _size )                                 { return stm_pushISR  (this, _data, _size); }
+	void * reserve   ( size_t *_size )                                                  { return stm_reserve   (this, _size); }
+	void * reserveISR( size_t *_size )                                                  { return stm_reserveISR(this, _size); }
+	void   commit    ( size_t  _size )                                                  {        stm_commit    (this, _size); }
+	void   commitISR ( size_t  _size )                                                  {        stm_commitISR (this, _size); }
+	const
+	void * peek      ( size_t *_size )                                                  { return stm_peek      (this, _size); }
+	const
+	void * peekISR   ( size_t *_size )                                                  { return stm_peekISR   (this, _size); }
+	void   consume   ( size_t  _size )                                                  {        stm_consume   (this, _size); }
+	void   consumeISR( size_t  _size )                                                  {        stm_consumeISR(this, _size); }
+#if __cplusplus >= 202002
+	std::span<char>
+	       reserve   ( void ) { size_t _size; char *_data = static_cast<char *>(stm_reserve   (this, &_size)); return { _data, _size }; }
+	std::span<char>
+	       reserveISR( void ) { size_t _size; char *_data = static_cast<char *>(stm_reserveISR(this, &_size)); return { _data, _size }; }
+	std::span<const char>
+	       peek      ( void ) { size_t _size; const char *_data = static_cast<const char *>(stm_peek   (this, &_size)); return { _data, _size }; }
+	std::span<const char>
+	       peekISR   ( void ) { size_t _size; const char *_data = static_cast<const char *>(stm_peekISR(this, &_size)); return { _data, _size }; }
+#endif
 	size_t count    ( void )                                                            { return stm_count    (this); }
 	size_t countISR ( void )                                                            { return stm_countISR (this); }
 	size_t space    ( void )                                                            { return stm_space    (this); }
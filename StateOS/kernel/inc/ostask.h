@@ -118,15 +118,20 @@ struct __tsk
 	char   * in;
 	}        data;
 	size_t   size;
-	}        stm;   // temporary data used by stream buffer object
+	size_t   level; // trigger level of the receiving task, 0 for the sending task
+	}        stm;   // temporary data used by stream buffer and broadcast stream objects
 
 	struct {
 	union  {
 	const
 	char   * out;
 	char   * in;
+	const
+	struct __iov * vec;
 	}        data;
 	size_t   size;
+	unsigned cnt;   // number of elements of the vector, 0 if data is not a vector
+	size_t   level; // trigger level of the receiving task, 0 for the sending task
 	}        msg;   // temporary data used by message buffer object
 
 	struct {
@@ -135,8 +140,44 @@ struct __tsk
 	void   * out;
 	void   * in;
 	}        data;
+	bool     send;  // true for the sending (giving or loaning) task
 	}        box;   // temporary data used by mailbox queue object
 
+	struct {
+	union  {
+	const
+	void   * out;
+	void   * in;
+	}        data;
+	unsigned prio;
+	}        prq;   // temporary data used by priority queue object
+
+	struct {
+	void   * data;
+	void  (* fun)( void *, void * );
+	}        chn;   // temporary data used by channel object
+
+	struct {
+	struct __mtx * mtx;
+	}        cnd;   // temporary data used by condition variable object
+
+	struct {
+	void   * obj;
+	}        set;   // temporary data used by object set
+
+	struct {
+	void   * data;
+	}        sub;   // temporary data used by subscriber object
+
+	struct {
+	struct __sub * sub;
+	}        tpc;   // temporary data used by topic object
+
+	struct {
+	struct __exe * exe;
+	struct __exj * job;
+	}        exe;   // temporary data used by executor object
+
 	struct {
 	unsigned event;
 	}        evq;   // temporary data used by event queue object
@@ -147,6 +188,18 @@ struct __tsk
 
 	}        tmp;
 
+#if OS_TASK_STATS
+	struct {
+	uint64_t cycles;// accumulated run time (in ticks of the statistics counter)
+	uint32_t count; // number of context switches to the task
+	uint32_t last;  // value of the statistics counter at the last context switch to the task
+	cnt_t    time;  // system time at the last context switch to the task
+	}        sts;
+#define _TSK_STATS_INIT() { 0, 0, 0, 0 },
+#else
+#define _TSK_STATS_INIT()
+#endif
+
 #ifndef _PORT_DATA_INIT
 #define _PORT_DATA_INIT()
 #else
@@ -179,7 +232,7 @@ extern "C" {
 
 #define               _TSK_INIT( _prio, _state, _stack, _size )                                               \
                        { _OBJ_INIT(), _HDR_INIT(), _state, 0, 0, 0, NULL, _stack, _size, NULL, _prio, _prio, NULL, NULL, 0, \
-                       { NULL, NULL }, { 0, NULL, { NULL, NULL } }, { { 0 } }, _PORT_DATA_INIT() }
+                       { NULL, NULL }, { 0, NULL, { NULL, NULL } }, { { 0 } }, _TSK_STATS_INIT() _PORT_DATA_INIT() }
 
 /******************************************************************************
  *
@@ -1176,13 +1229,20 @@ void cur_suspend( void ) { tsk_suspend(System.cur); }
  *
  * Note              : can be used in both thread and handler mode (for blockable interrupts)
  *                     use ISR alias in blockable interrupt handlers
+ *                     with OS_DEFER_SIZE > 0 the ISR alias only posts a request to the deferred services queue:
+ *                     E_SUCCESS means the request was queued, a task that cannot be resumed is never reported,
+ *                     E_TIMEOUT means the deferred services queue is full and the request was dropped
  *
  ******************************************************************************/
 
 int tsk_resume( tsk_t *tsk );
 
+#if OS_DEFER_SIZE
+int tsk_resumeISR( tsk_t *tsk );
+#else
 __STATIC_INLINE
 int tsk_resumeISR( tsk_t *tsk ) { return tsk_resume(tsk); }
+#endif
 
 /******************************************************************************
  *
@@ -1288,6 +1348,83 @@ size_t tsk_stackSpace( void )
 #endif
 }
 
+#if OS_TASK_STATS
+
+/******************************************************************************
+ *
+ * Name              : task statistics
+ *
+ ******************************************************************************/
+
+typedef struct __sts
+{
+	tsk_t  * tsk;   // task
+	uint64_t cycles;// accumulated run time (in ticks of the statistics counter)
+	uint32_t count; // number of context switches to the task
+	uint32_t last;  // value of the statistics counter at the last context switch to the task
+
+}	sts_t;
+
+/******************************************************************************
+ *
+ * Name              : tsk_getStats
+ * ISR alias         : tsk_getStatsISR
+ *
+ * Description       : get run-time statistics of the task
+ *
+ * Parameters
+ *   tsk             : pointer to the task object
+ *   sts             : pointer to store the statistics of the task
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     run time of the current task includes the time since the last context switch
+ *
+ ******************************************************************************/
+
+void tsk_getStats( tsk_t *tsk, sts_t *sts );
+
+__STATIC_INLINE
+void tsk_getStatsISR( tsk_t *tsk, sts_t *sts ) { tsk_getStats(tsk, sts); }
+
+/******************************************************************************
+ *
+ * Name              : tsk_getSnapshot
+ *
+ * Description       : get run-time statistics of all tasks (ready, delayed and blocked) at once
+ *
+ * Parameters
+ *   tab             : pointer to the table to store the statistics of tasks
+ *   limit           : size of the table (in number of elements)
+ *
+ * Return            : number of elements stored in the table
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     IDLE task is always stored as the first element
+ *
+ ******************************************************************************/
+
+unsigned tsk_getSnapshot( sts_t *tab, unsigned limit );
+
+/******************************************************************************
+ *
+ * Name              : tsk_getLoad
+ *
+ * Description       : get cpu load since the previous call of the function
+ *
+ * Parameters        : none
+ *
+ * Return            : cpu load (in per mille), i.e. 1000 minus idle ratio
+ *
+ * Note              : can be used in both thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned tsk_getLoad( void );
+
+#endif//OS_TASK_STATS
+
 #ifdef __cplusplus
 }
 #endif
@@ -1367,6 +1504,9 @@ struct baseTask : public __tsk
 	int      resumeISR( void )             { return tsk_resumeISR(this); }
 	void     give     ( unsigned _signo )  {        tsk_give     (this, _signo); }
 	void     signal   ( unsigned _signo )  {        tsk_signal   (this, _signo); }
+#if OS_TASK_STATS
+	sts_t    getStats ( void )             { sts_t _sts; tsk_getStats(this, &_sts); return _sts; }
+#endif
 #if __cplusplus >= 201402
 	template<class F>
 	void     action   ( F&&      _action ) {        new (&act) Act_t(_action);
@@ -1724,6 +1864,39 @@ struct TaskT : public baseTask, public baseStack<size_>
 
 using Task = TaskT<OS_STACK_SIZE>;
 
+#if OS_TASK_STATS
+
+/******************************************************************************
+ *
+ * Class             : TaskStatsT<>
+ *
+ * Description       : create and initialize a snapshot of run-time statistics of all tasks
+ *
+ * Constructor parameters
+ *   limit           : maximum number of tasks in the snapshot
+ *
+ ******************************************************************************/
+
+template<unsigned limit_>
+struct TaskStatsT
+{
+	TaskStatsT( void ) { update(); }
+
+	void          update( void )       { size_ = tsk_getSnapshot(data_, limit_); }
+	unsigned      size  ( void ) const { return size_; }
+	const sts_t * begin ( void ) const { return data_; }
+	const sts_t * end   ( void ) const { return data_ + size_; }
+	const sts_t & operator[]( unsigned _idx ) const { return data_[_idx]; }
+	static
+	unsigned      load  ( void )       { return tsk_getLoad(); }
+
+	private:
+	unsigned size_;
+	sts_t    data_[limit_];
+};
+
+#endif//OS_TASK_STATS
+
 }     //  namespace
 #endif//__cplusplus
 
@@ -0,0 +1,1221 @@
+/******************************************************************************
+
+    @file    StateOS: ostopic.h
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file contains definitions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_TPC_H
+#define __STATEOS_TPC_H
+
+#include "oskernel.h"
+#include "osclock.h"
+#include "osmemorypool.h"
+
+/* -------------------------------------------------------------------------- */
+
+#define TPC_SIZE( size ) \
+   (1 + MEM_SIZE( size ))
+
+/******************************************************************************
+ *
+ * Name              : topic (publish / subscribe broker)
+ *
+ ******************************************************************************/
+
+typedef struct __tpc tpc_t, * const tpc_id;
+
+struct __tpc
+{
+	obj_t    obj;   // object header (publishers waiting for subscribers)
+
+	mem_t    mem;   // memory pool of messages (each message is preceded by its reference counter)
+	struct __sub *
+	         subs;  // list of subscribers
+	unsigned seq;   // sequence number of the last published message
+};
+
+/******************************************************************************
+ *
+ * Name              : subscriber
+ *
+ ******************************************************************************/
+
+// overflow policies of the subscriber
+enum
+{
+	subDropOldest = 0, // the oldest message is dropped from the full subscriber queue
+	subDropNewest,     // the new message is not delivered to the full subscriber queue
+	subBlock,          // the publisher waits for space in the full subscriber queue
+};
+
+typedef struct __sub sub_t, * const sub_id;
+
+struct __sub
+{
+	obj_t    obj;   // object header (tasks waiting for messages)
+
+	sub_t  * next;  // next subscriber of the topic
+	tpc_t  * tpc;   // subscribed topic
+	unsigned seq;   // sequence number of the last message published before the subscription
+	unsigned mode;  // overflow policy
+	unsigned lost;  // number of dropped messages
+
+	unsigned count; // number of messages in the subscriber queue
+	unsigned limit; // size of the subscriber queue (max number of messages)
+	unsigned head;  // first element to read from data buffer
+	unsigned tail;  // first element to write into data buffer
+	void  ** data;  // data buffer
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+ *
+ * Name              : _TPC_INIT
+ *
+ * Description       : create and initialize a topic object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of messages)
+ *   size            : size of message block (in sizeof(que_t) units, including reference counter)
+ *   data            : topic data buffer
+ *
+ * Return            : topic object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _TPC_INIT( _limit, _size, _data ) { _OBJ_INIT(), _MEM_INIT( _limit, _size, _data ), NULL, 0 }
+
+/******************************************************************************
+ *
+ * Name              : _TPC_DATA
+ *
+ * Description       : create a topic data buffer
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of messages)
+ *   size            : size of message block (in sizeof(que_t) units, including reference counter)
+ *
+ * Return            : topic data buffer
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _TPC_DATA( _limit, _size ) _MEM_DATA( _limit, _size )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : OS_TPC
+ *
+ * Description       : define and initialize a topic object
+ *
+ * Parameters
+ *   tpc             : name of a pointer to topic object
+ *   limit           : size of a buffer (max number of messages)
+ *   size            : size of message (in bytes)
+ *
+ * Note              : the message pool must be initialized with tpc_bind
+ *
+ ******************************************************************************/
+
+#define             OS_TPC( tpc, limit, size )                                          \
+                       que_t tpc##__buf[limit * (1 + TPC_SIZE(size))];                   \
+                       tpc_t tpc##__tpc = _TPC_INIT( limit, TPC_SIZE(size), tpc##__buf ); \
+                       tpc_id tpc = & tpc##__tpc
+
+/******************************************************************************
+ *
+ * Name              : static_TPC
+ *
+ * Description       : define and initialize a static topic object
+ *
+ * Parameters
+ *   tpc             : name of a pointer to topic object
+ *   limit           : size of a buffer (max number of messages)
+ *   size            : size of message (in bytes)
+ *
+ * Note              : the message pool must be initialized with tpc_bind
+ *
+ ******************************************************************************/
+
+#define         static_TPC( tpc, limit, size )                                          \
+                static que_t tpc##__buf[limit * (1 + TPC_SIZE(size))];                   \
+                static tpc_t tpc##__tpc = _TPC_INIT( limit, TPC_SIZE(size), tpc##__buf ); \
+                static tpc_id tpc = & tpc##__tpc
+
+/******************************************************************************
+ *
+ * Name              : TPC_INIT
+ *
+ * Description       : create and initialize a topic object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of messages)
+ *   size            : size of message (in bytes)
+ *
+ * Return            : topic object
+ *
+ * Note              : use only in 'C' code
+ *                     the message pool must be initialized with tpc_bind
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                TPC_INIT( limit, size ) \
+                      _TPC_INIT( limit, TPC_SIZE(size), _TPC_DATA(limit, TPC_SIZE(size)) )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : TPC_CREATE
+ * Alias             : TPC_NEW
+ *
+ * Description       : create and initialize a topic object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of messages)
+ *   size            : size of message (in bytes)
+ *
+ * Return            : pointer to topic object
+ *
+ * Note              : use only in 'C' code
+ *                     the message pool must be initialized with tpc_bind
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                TPC_CREATE( limit, size ) \
+           (tpc_t[]) { TPC_INIT  ( limit, size ) }
+#define                TPC_NEW \
+                       TPC_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : tpc_bind
+ *
+ * Description       : initialize the message pool of a topic object
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void tpc_bind( tpc_t *tpc );
+
+/******************************************************************************
+ *
+ * Name              : tpc_init
+ *
+ * Description       : initialize a topic object
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   size            : size of message (in bytes)
+ *   data            : topic data buffer
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void tpc_init( tpc_t *tpc, size_t size, que_t *data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : tpc_create
+ * Alias             : tpc_new
+ *
+ * Description       : create and initialize a new topic object
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of messages)
+ *   size            : size of message (in bytes)
+ *
+ * Return            : pointer to topic object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+tpc_t *tpc_create( unsigned limit, size_t size );
+
+__STATIC_INLINE
+tpc_t *tpc_new( unsigned limit, size_t size ) { return tpc_create(limit, size); }
+
+/******************************************************************************
+ *
+ * Name              : tpc_reset
+ * Alias             : tpc_kill
+ *
+ * Description       : wake up all tasks waiting for a free message block or for subscribers with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void tpc_reset( tpc_t *tpc );
+
+__STATIC_INLINE
+void tpc_kill( tpc_t *tpc ) { tpc_reset(tpc); }
+
+/******************************************************************************
+ *
+ * Name              : tpc_destroy
+ * Alias             : tpc_delete
+ *
+ * Description       : unsubscribe all subscribers, wake up all tasks waiting for a free message block or for subscribers
+ *                     with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *                     all messages taken by subscribers must be released before
+ *
+ ******************************************************************************/
+
+void tpc_destroy( tpc_t *tpc );
+
+__STATIC_INLINE
+void tpc_delete( tpc_t *tpc ) { tpc_destroy(tpc); }
+
+/******************************************************************************
+ *
+ * Name              : tpc_loan
+ * Alias             : tpc_tryLoan
+ * ISR alias         : tpc_loanISR
+ *
+ * Description       : try to get a free message block from the topic object,
+ *                     don't wait if there are no free message blocks,
+ *                     the message has to be filled in place and published with tpc_publish
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : pointer to the variable getting the address of the message
+ *
+ * Return
+ *   E_SUCCESS       : the message block was successfully loaned
+ *   E_TIMEOUT       : there are no free message blocks, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+int tpc_loan( tpc_t *tpc, void **data );
+
+__STATIC_INLINE
+int tpc_tryLoan( tpc_t *tpc, void **data ) { return tpc_loan(tpc, data); }
+
+__STATIC_INLINE
+int tpc_loanISR( tpc_t *tpc, void **data ) { return tpc_loan(tpc, data); }
+
+/******************************************************************************
+ *
+ * Name              : tpc_loanFor
+ *
+ * Description       : try to get a free message block from the topic object,
+ *                     wait for given duration of time while there are no free message blocks,
+ *                     the message has to be filled in place and published with tpc_publish
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : pointer to the variable getting the address of the message
+ *   delay           : duration of time (maximum number of ticks to wait for a free message block)
+ *                     IMMEDIATE: don't wait if there are no free message blocks
+ *                     INFINITE:  wait indefinitely for a free message block
+ *
+ * Return
+ *   E_SUCCESS       : the message block was successfully loaned
+ *   E_STOPPED       : topic object was reseted before the specified timeout expired
+ *   E_DELETED       : topic object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : there was no free message block before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int tpc_loanFor( tpc_t *tpc, void **data, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : tpc_loanUntil
+ *
+ * Description       : try to get a free message block from the topic object,
+ *                     wait until given timepoint while there are no free message blocks,
+ *                     the message has to be filled in place and published with tpc_publish
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : pointer to the variable getting the address of the message
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the message block was successfully loaned
+ *   E_STOPPED       : topic object was reseted before the specified timeout expired
+ *   E_DELETED       : topic object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : there was no free message block before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int tpc_loanUntil( tpc_t *tpc, void **data, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : tpc_loanWait
+ *
+ * Description       : try to get a free message block from the topic object,
+ *                     wait indefinitely while there are no free message blocks,
+ *                     the message has to be filled in place and published with tpc_publish
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : pointer to the variable getting the address of the message
+ *
+ * Return
+ *   E_SUCCESS       : the message block was successfully loaned
+ *   E_STOPPED       : topic object was reseted
+ *   E_DELETED       : topic object was deleted
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int tpc_loanWait( tpc_t *tpc, void **data ) { return tpc_loanFor(tpc, data, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : tpc_publish
+ * ISR alias         : tpc_publishISR
+ *
+ * Description       : deliver the loaned message to all subscribers of the topic object without copying,
+ *                     don't wait for subscribers with full queues,
+ *                     the message returns to the message pool when the last subscriber releases it
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : address of the loaned message
+ *
+ * Return
+ *   E_SUCCESS       : the message was delivered to all subscribers (except dropped by overflow policy)
+ *   E_TIMEOUT       : the message was not delivered to some subscribers with 'subBlock' overflow policy
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the publisher loses access to the message in any case
+ *
+ ******************************************************************************/
+
+int tpc_publish( tpc_t *tpc, void *data );
+
+__STATIC_INLINE
+int tpc_publishISR( tpc_t *tpc, void *data ) { return tpc_publish(tpc, data); }
+
+/******************************************************************************
+ *
+ * Name              : tpc_publishFor
+ *
+ * Description       : deliver the loaned message to all subscribers of the topic object without copying,
+ *                     wait for given duration of time for space in queues of subscribers with 'subBlock' overflow policy,
+ *                     the message returns to the message pool when the last subscriber releases it
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : address of the loaned message
+ *   delay           : duration of time (maximum number of ticks to wait for subscribers)
+ *                     IMMEDIATE: don't wait for subscribers
+ *                     INFINITE:  wait indefinitely for subscribers
+ *
+ * Return
+ *   E_SUCCESS       : the message was delivered to all subscribers (except dropped by overflow policy)
+ *   E_STOPPED       : topic object was reseted before the specified timeout expired
+ *   E_DELETED       : topic object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : the message was not delivered to some subscribers before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the publisher loses access to the message in any case
+ *
+ ******************************************************************************/
+
+int tpc_publishFor( tpc_t *tpc, void *data, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : tpc_publishUntil
+ *
+ * Description       : deliver the loaned message to all subscribers of the topic object without copying,
+ *                     wait until given timepoint for space in queues of subscribers with 'subBlock' overflow policy,
+ *                     the message returns to the message pool when the last subscriber releases it
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : address of the loaned message
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the message was delivered to all subscribers (except dropped by overflow policy)
+ *   E_STOPPED       : topic object was reseted before the specified timeout expired
+ *   E_DELETED       : topic object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : the message was not delivered to some subscribers before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the publisher loses access to the message in any case
+ *
+ ******************************************************************************/
+
+int tpc_publishUntil( tpc_t *tpc, void *data, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : tpc_publishWait
+ *
+ * Description       : deliver the loaned message to all subscribers of the topic object without copying,
+ *                     wait indefinitely for space in queues of subscribers with 'subBlock' overflow policy,
+ *                     the message returns to the message pool when the last subscriber releases it
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : address of the loaned message
+ *
+ * Return
+ *   E_SUCCESS       : the message was delivered to all subscribers (except dropped by overflow policy)
+ *   E_STOPPED       : topic object was reseted
+ *   E_DELETED       : topic object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     the publisher loses access to the message in any case
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int tpc_publishWait( tpc_t *tpc, void *data ) { return tpc_publishFor(tpc, data, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : tpc_retain
+ * ISR alias         : tpc_retainISR
+ *
+ * Description       : add a reference to the message
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : address of the message
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     each reference has to be released with tpc_release
+ *
+ ******************************************************************************/
+
+void tpc_retain( tpc_t *tpc, void *data );
+
+__STATIC_INLINE
+void tpc_retainISR( tpc_t *tpc, void *data ) { tpc_retain(tpc, data); }
+
+/******************************************************************************
+ *
+ * Name              : tpc_release
+ * ISR alias         : tpc_releaseISR
+ *
+ * Description       : release a reference to the message (loaned, taken or retained),
+ *                     the message returns to the message pool when the last reference is released
+ *
+ * Parameters
+ *   tpc             : pointer to topic object
+ *   data            : address of the message
+ *
+ * Return            : none
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+void tpc_release( tpc_t *tpc, void *data );
+
+__STATIC_INLINE
+void tpc_releaseISR( tpc_t *tpc, void *data ) { tpc_release(tpc, data); }
+
+/******************************************************************************
+ *
+ * Name              : _SUB_INIT
+ *
+ * Description       : create and initialize a subscriber object
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of messages)
+ *   mode            : overflow policy
+ *                     subDropOldest: the oldest message is dropped from the full queue
+ *                     subDropNewest: the new message is not delivered to the full queue
+ *                     subBlock:      the publisher waits for space in the full queue
+ *   data            : subscriber data buffer
+ *
+ * Return            : subscriber object
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#define               _SUB_INIT( _limit, _mode, _data ) { _OBJ_INIT(), NULL, NULL, 0, _mode, 0, 0, _limit, 0, 0, _data }
+
+/******************************************************************************
+ *
+ * Name              : _SUB_DATA
+ *
+ * Description       : create a subscriber data buffer
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of messages)
+ *
+ * Return            : subscriber data buffer
+ *
+ * Note              : for internal use
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define               _SUB_DATA( _limit ) (void *[_limit]){ NULL }
+#endif
+
+/******************************************************************************
+ *
+ * Name              : OS_SUB
+ *
+ * Description       : define and initialize a subscriber object
+ *
+ * Parameters
+ *   sub             : name of a pointer to subscriber object
+ *   limit           : size of a queue (max number of messages)
+ *   mode            : overflow policy
+ *
+ ******************************************************************************/
+
+#define             OS_SUB( sub, limit, mode )                                \
+                       void *sub##__buf[limit];                                \
+                       sub_t sub##__sub = _SUB_INIT( limit, mode, sub##__buf ); \
+                       sub_id sub = & sub##__sub
+
+/******************************************************************************
+ *
+ * Name              : static_SUB
+ *
+ * Description       : define and initialize a static subscriber object
+ *
+ * Parameters
+ *   sub             : name of a pointer to subscriber object
+ *   limit           : size of a queue (max number of messages)
+ *   mode            : overflow policy
+ *
+ ******************************************************************************/
+
+#define         static_SUB( sub, limit, mode )                                \
+                static void *sub##__buf[limit];                                \
+                static sub_t sub##__sub = _SUB_INIT( limit, mode, sub##__buf ); \
+                static sub_id sub = & sub##__sub
+
+/******************************************************************************
+ *
+ * Name              : SUB_INIT
+ *
+ * Description       : create and initialize a subscriber object
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of messages)
+ *   mode            : overflow policy
+ *
+ * Return            : subscriber object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                SUB_INIT( limit, mode ) \
+                      _SUB_INIT( limit, mode, _SUB_DATA( limit ) )
+#endif
+
+/******************************************************************************
+ *
+ * Name              : SUB_CREATE
+ * Alias             : SUB_NEW
+ *
+ * Description       : create and initialize a subscriber object
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of messages)
+ *   mode            : overflow policy
+ *
+ * Return            : pointer to subscriber object
+ *
+ * Note              : use only in 'C' code
+ *
+ ******************************************************************************/
+
+#ifndef __cplusplus
+#define                SUB_CREATE( limit, mode ) \
+           (sub_t[]) { SUB_INIT  ( limit, mode ) }
+#define                SUB_NEW \
+                       SUB_CREATE
+#endif
+
+/******************************************************************************
+ *
+ * Name              : sub_init
+ *
+ * Description       : initialize a subscriber object
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *   mode            : overflow policy
+ *                     subDropOldest: the oldest message is dropped from the full queue
+ *                     subDropNewest: the new message is not delivered to the full queue
+ *                     subBlock:      the publisher waits for space in the full queue
+ *   data            : subscriber data buffer
+ *   bufsize         : size of the data buffer (in bytes)
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void sub_init( sub_t *sub, unsigned mode, void **data, size_t bufsize );
+
+/******************************************************************************
+ *
+ * Name              : sub_create
+ * Alias             : sub_new
+ *
+ * Description       : create and initialize a new subscriber object
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of messages)
+ *   mode            : overflow policy
+ *
+ * Return            : pointer to subscriber object
+ *   NULL            : object not created (not enough free memory)
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+sub_t *sub_create( unsigned limit, unsigned mode );
+
+__STATIC_INLINE
+sub_t *sub_new( unsigned limit, unsigned mode ) { return sub_create(limit, mode); }
+
+/******************************************************************************
+ *
+ * Name              : sub_reset
+ * Alias             : sub_kill
+ *
+ * Description       : drop all messages from the subscriber queue and wake up all waiting tasks with 'E_STOPPED' event value
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void sub_reset( sub_t *sub );
+
+__STATIC_INLINE
+void sub_kill( sub_t *sub ) { sub_reset(sub); }
+
+/******************************************************************************
+ *
+ * Name              : sub_destroy
+ * Alias             : sub_delete
+ *
+ * Description       : unsubscribe the topic, drop all messages from the subscriber queue,
+ *                     wake up all waiting tasks with 'E_DELETED' event value and free allocated resource
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void sub_destroy( sub_t *sub );
+
+__STATIC_INLINE
+void sub_delete( sub_t *sub ) { sub_destroy(sub); }
+
+/******************************************************************************
+ *
+ * Name              : sub_subscribe
+ *
+ * Description       : subscribe the topic object,
+ *                     the subscriber receives messages published after subscription
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *   tpc             : pointer to topic object
+ *
+ * Return
+ *   E_SUCCESS       : the topic was successfully subscribed
+ *   E_FAILURE       : the subscriber has already subscribed a topic
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+int sub_subscribe( sub_t *sub, tpc_t *tpc );
+
+/******************************************************************************
+ *
+ * Name              : sub_unsubscribe
+ *
+ * Description       : unsubscribe the topic object and drop all messages from the subscriber queue
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *
+ * Return            : none
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+void sub_unsubscribe( sub_t *sub );
+
+/******************************************************************************
+ *
+ * Name              : sub_take
+ * Alias             : sub_tryWait
+ * ISR alias         : sub_takeISR
+ *
+ * Description       : try to take a message from the subscriber queue,
+ *                     don't wait if the subscriber queue is empty
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *   data            : pointer to the variable getting the address of the message
+ *
+ * Return
+ *   E_SUCCESS       : the message was successfully taken
+ *   E_TIMEOUT       : subscriber queue is empty, try again
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *                     the taken message has to be released with tpc_release
+ *
+ ******************************************************************************/
+
+int sub_take( sub_t *sub, void **data );
+
+__STATIC_INLINE
+int sub_tryWait( sub_t *sub, void **data ) { return sub_take(sub, data); }
+
+__STATIC_INLINE
+int sub_takeISR( sub_t *sub, void **data ) { return sub_take(sub, data); }
+
+/******************************************************************************
+ *
+ * Name              : sub_waitFor
+ *
+ * Description       : try to take a message from the subscriber queue,
+ *                     wait for given duration of time while the subscriber queue is empty
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *   data            : pointer to the variable getting the address of the message
+ *   delay           : duration of time (maximum number of ticks to wait while the subscriber queue is empty)
+ *                     IMMEDIATE: don't wait if the subscriber queue is empty
+ *                     INFINITE:  wait indefinitely while the subscriber queue is empty
+ *
+ * Return
+ *   E_SUCCESS       : the message was successfully taken
+ *   E_STOPPED       : subscriber object was reseted before the specified timeout expired
+ *   E_DELETED       : subscriber object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : subscriber queue is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the taken message has to be released with tpc_release
+ *
+ ******************************************************************************/
+
+int sub_waitFor( sub_t *sub, void **data, cnt_t delay );
+
+/******************************************************************************
+ *
+ * Name              : sub_waitUntil
+ *
+ * Description       : try to take a message from the subscriber queue,
+ *                     wait until given timepoint while the subscriber queue is empty
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *   data            : pointer to the variable getting the address of the message
+ *   time            : timepoint value
+ *
+ * Return
+ *   E_SUCCESS       : the message was successfully taken
+ *   E_STOPPED       : subscriber object was reseted before the specified timeout expired
+ *   E_DELETED       : subscriber object was deleted before the specified timeout expired
+ *   E_TIMEOUT       : subscriber queue is empty and was not received data before the specified timeout expired
+ *
+ * Note              : use only in thread mode
+ *                     the taken message has to be released with tpc_release
+ *
+ ******************************************************************************/
+
+int sub_waitUntil( sub_t *sub, void **data, cnt_t time );
+
+/******************************************************************************
+ *
+ * Name              : sub_wait
+ *
+ * Description       : try to take a message from the subscriber queue,
+ *                     wait indefinitely while the subscriber queue is empty
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *   data            : pointer to the variable getting the address of the message
+ *
+ * Return
+ *   E_SUCCESS       : the message was successfully taken
+ *   E_STOPPED       : subscriber object was reseted
+ *   E_DELETED       : subscriber object was deleted
+ *
+ * Note              : use only in thread mode
+ *                     the taken message has to be released with tpc_release
+ *
+ ******************************************************************************/
+
+__STATIC_INLINE
+int sub_wait( sub_t *sub, void **data ) { return sub_waitFor(sub, data, INFINITE); }
+
+/******************************************************************************
+ *
+ * Name              : sub_count
+ * ISR alias         : sub_countISR
+ *
+ * Description       : return the number of messages in the subscriber queue
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *
+ * Return            : number of messages in the subscriber queue
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned sub_count( sub_t *sub );
+
+__STATIC_INLINE
+unsigned sub_countISR( sub_t *sub ) { return sub_count(sub); }
+
+/******************************************************************************
+ *
+ * Name              : sub_lost
+ * ISR alias         : sub_lostISR
+ *
+ * Description       : return the number of messages dropped by the subscriber
+ *
+ * Parameters
+ *   sub             : pointer to subscriber object
+ *
+ * Return            : number of dropped messages
+ *
+ * Note              : can be used in both thread and handler mode (for blockable interrupts)
+ *                     use ISR alias in blockable interrupt handlers
+ *
+ ******************************************************************************/
+
+unsigned sub_lost( sub_t *sub );
+
+__STATIC_INLINE
+unsigned sub_lostISR( sub_t *sub ) { return sub_lost(sub); }
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+namespace stateos {
+
+/******************************************************************************
+ *
+ * Class             : MessageRef<>
+ *
+ * Description       : reference to the message of the topic,
+ *                     the message is released when the reference is destroyed
+ *
+ * Constructor parameters
+ *   T               : type of the message
+ *
+ ******************************************************************************/
+
+template<class T = void>
+struct MessageRef
+{
+	MessageRef( void ): tpc_{nullptr}, data_{nullptr} {}
+	MessageRef( __tpc *_tpc, void *_data ): tpc_{_tpc}, data_{static_cast<T *>(_data)} {}
+	MessageRef( MessageRef&& _ref ): tpc_{_ref.tpc_}, data_{_ref.data_} { _ref.tpc_ = nullptr; _ref.data_ = nullptr; }
+	MessageRef( const MessageRef& _ref ): tpc_{_ref.tpc_}, data_{_ref.data_} { if (data_ != nullptr) tpc_retain(tpc_, data_); }
+	MessageRef& operator=( MessageRef&& _ref )      { if (this != &_ref) { reset(); tpc_ = _ref.tpc_; data_ = _ref.data_; _ref.tpc_ = nullptr; _ref.data_ = nullptr; } return *this; }
+	MessageRef& operator=( const MessageRef& _ref ) { if (this != &_ref) { reset(); tpc_ = _ref.tpc_; data_ = _ref.data_; if (data_ != nullptr) tpc_retain(tpc_, data_); } return *this; }
+
+	~MessageRef( void ) { reset(); }
+
+	void reset( void )                      { if (data_ != nullptr) tpc_release(tpc_, data_); tpc_ = nullptr; data_ = nullptr; }
+	void reset( __tpc *_tpc, void *_data )  { reset(); tpc_ = _tpc; data_ = static_cast<T *>(_data); }
+	T *  release( void )                    { T *_data = data_; tpc_ = nullptr; data_ = nullptr; return _data; }
+	T *  get    ( void ) const              { return data_; }
+	T *  operator->( void ) const           { return data_; }
+	template<class U = T>
+	U &  operator* ( void ) const           { return *data_; }
+	explicit
+	operator bool( void ) const             { return data_ != nullptr; }
+
+	private:
+	__tpc *tpc_;
+	T     *data_;
+};
+
+/******************************************************************************
+ *
+ * Class             : TopicT<>
+ *
+ * Description       : create and initialize a topic object
+ *
+ * Constructor parameters
+ *   limit           : size of a buffer (max number of messages)
+ *   size            : size of message (in bytes)
+ *
+ ******************************************************************************/
+
+template<unsigned limit_, size_t size_>
+struct TopicT : public __tpc
+{
+	TopicT( void ): __tpc _TPC_INIT(limit_, TPC_SIZE(size_), data_) { tpc_bind(this); }
+
+	TopicT( TopicT&& ) = default;
+	TopicT( const TopicT& ) = delete;
+	TopicT& operator=( TopicT&& ) = delete;
+	TopicT& operator=( const TopicT& ) = delete;
+
+	~TopicT( void ) { assert(__tpc::obj.queue == nullptr); assert(__tpc::subs == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<TopicT<limit_, size_>>;
+#else
+	using Ptr = TopicT<limit_, size_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : TopicT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   limit           : size of a buffer (max number of messages)
+ *   size            : size of message (in bytes)
+ *
+ * Return            : std::unique_pointer / pointer to TopicT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( void )
+	{
+		auto tpc = new TopicT<limit_, size_>();
+		if (tpc != nullptr)
+			tpc->__tpc::obj.res = tpc;
+		return Ptr(tpc);
+	}
+
+	void     reset       ( void )                              {        tpc_reset       (this); }
+	void     kill        ( void )                              {        tpc_kill        (this); }
+	void     destroy     ( void )                              {        tpc_destroy     (this); }
+	int      loan        ( void **_data )                      { return tpc_loan        (this, _data); }
+	int      tryLoan     ( void **_data )                      { return tpc_tryLoan     (this, _data); }
+	int      loanISR     ( void **_data )                      { return tpc_loanISR     (this, _data); }
+	template<typename T>
+	int      loanFor     ( void **_data, const T _delay )      { return tpc_loanFor     (this, _data, Clock::count(_delay)); }
+	template<typename T>
+	int      loanUntil   ( void **_data, const T _time )       { return tpc_loanUntil   (this, _data, Clock::until(_time)); }
+	int      loanWait    ( void **_data )                      { return tpc_loanWait    (this, _data); }
+	int      publish     ( void  *_data )                      { return tpc_publish     (this, _data); }
+	int      publishISR  ( void  *_data )                      { return tpc_publishISR  (this, _data); }
+	template<typename T>
+	int      publishFor  ( void  *_data, const T _delay )      { return tpc_publishFor  (this, _data, Clock::count(_delay)); }
+	template<typename T>
+	int      publishUntil( void  *_data, const T _time )       { return tpc_publishUntil(this, _data, Clock::until(_time)); }
+	int      publishWait ( void  *_data )                      { return tpc_publishWait (this, _data); }
+	template<class M>
+	int      publish     ( MessageRef<M>& _ref )               { return tpc_publish     (this, _ref.release()); }
+	template<class M, typename T>
+	int      publishFor  ( MessageRef<M>& _ref, const T _delay ) { return tpc_publishFor(this, _ref.release(), Clock::count(_delay)); }
+	template<class M>
+	int      publishWait ( MessageRef<M>& _ref )               { return tpc_publishWait (this, _ref.release()); }
+	void     retain      ( void  *_data )                      {        tpc_retain      (this, _data); }
+	void     release     ( void  *_data )                      {        tpc_release     (this, _data); }
+
+	template<class M = void>
+	MessageRef<M> loan   ( void )                              { void *_data; return MessageRef<M>(this, tpc_loan(this, &_data) == E_SUCCESS ? _data : nullptr); }
+	template<class M = void>
+	MessageRef<M> loanWait( void )                             { void *_data; return MessageRef<M>(this, tpc_loanWait(this, &_data) == E_SUCCESS ? _data : nullptr); }
+
+	private:
+	que_t data_[limit_ * (1 + TPC_SIZE(size_))];
+};
+
+/******************************************************************************
+ *
+ * Class             : SubscriberT<>
+ *
+ * Description       : create and initialize a subscriber object
+ *
+ * Constructor parameters
+ *   limit           : size of a queue (max number of messages)
+ *   mode            : overflow policy
+ *
+ ******************************************************************************/
+
+template<unsigned limit_>
+struct SubscriberT : public __sub
+{
+	constexpr
+	SubscriberT( const unsigned _mode = subDropOldest ): __sub _SUB_INIT(limit_, _mode, data_) {}
+
+	SubscriberT( SubscriberT&& ) = default;
+	SubscriberT( const SubscriberT& ) = delete;
+	SubscriberT& operator=( SubscriberT&& ) = delete;
+	SubscriberT& operator=( const SubscriberT& ) = delete;
+
+	~SubscriberT( void ) { assert(__sub::obj.queue == nullptr); assert(__sub::tpc == nullptr); }
+
+#if __cplusplus >= 201402
+	using Ptr = std::unique_ptr<SubscriberT<limit_>>;
+#else
+	using Ptr = SubscriberT<limit_> *;
+#endif
+
+/******************************************************************************
+ *
+ * Name              : SubscriberT<>::Create
+ *
+ * Description       : create dynamic object with manageable resources
+ *
+ * Parameters
+ *   limit           : size of a queue (max number of messages)
+ *   mode            : overflow policy
+ *
+ * Return            : std::unique_pointer / pointer to SubscriberT<> object
+ *
+ * Note              : use only in thread mode
+ *
+ ******************************************************************************/
+
+	static
+	Ptr Create( const unsigned _mode = subDropOldest )
+	{
+		auto sub = new SubscriberT<limit_>(_mode);
+		if (sub != nullptr)
+			sub->__sub::obj.res = sub;
+		return Ptr(sub);
+	}
+
+	void     reset      ( void )                           {        sub_reset      (this); }
+	void     kill       ( void )                           {        sub_kill       (this); }
+	void     destroy    ( void )                           {        sub_destroy    (this); }
+	int      subscribe  ( __tpc *_tpc )                    { return sub_subscribe  (this, _tpc); }
+	void     unsubscribe( void )                           {        sub_unsubscribe(this); }
+	int      take       ( void **_data )                   { return sub_take       (this, _data); }
+	int      tryWait    ( void **_data )                   { return sub_tryWait    (this, _data); }
+	int      takeISR    ( void **_data )                   { return sub_takeISR    (this, _data); }
+	template<typename T>
+	int      waitFor    ( void **_data, const T _delay )   { return sub_waitFor    (this, _data, Clock::count(_delay)); }
+	template<typename T>
+	int      waitUntil  ( void **_data, const T _time )    { return sub_waitUntil  (this, _data, Clock::until(_time)); }
+	int      wait       ( void **_data )                   { return sub_wait       (this, _data); }
+	template<class M>
+	int      take       ( MessageRef<M>& _ref )            { void *_data; int _result = sub_take   (this, &_data); if (_result == E_SUCCESS) _ref.reset(__sub::tpc, _data); return _result; }
+	template<class M, typename T>
+	int      waitFor    ( MessageRef<M>& _ref, const T _delay ) { void *_data; int _result = sub_waitFor(this, &_data, Clock::count(_delay)); if (_result == E_SUCCESS) _ref.reset(__sub::tpc, _data); return _result; }
+	template<class M, typename T>
+	int      waitUntil  ( MessageRef<M>& _ref, const T _time )  { void *_data; int _result = sub_waitUntil(this, &_data, Clock::until(_time)); if (_result == E_SUCCESS) _ref.reset(__sub::tpc, _data); return _result; }
+	template<class M>
+	int      wait       ( MessageRef<M>& _ref )            { void *_data; int _result = sub_wait   (this, &_data); if (_result == E_SUCCESS) _ref.reset(__sub::tpc, _data); return _result; }
+	unsigned count      ( void )                           { return sub_count      (this); }
+	unsigned countISR   ( void )                           { return sub_countISR   (this); }
+	unsigned lost       ( void )                           { return sub_lost       (this); }
+	unsigned lostISR    ( void )                           { return sub_lostISR    (this); }
+
+	private:
+	void *data_[limit_];
+};
+
+}     //  namespace
+#endif//__cplusplus
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_TPC_H
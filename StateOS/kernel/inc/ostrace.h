@@ -0,0 +1,111 @@
+/******************************************************************************
+
+    @file    StateOS: ostrace.h
+    @author  Rajmund Szymanski
+    @date    04.03.2021
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#ifndef __STATEOS_TRC_H
+#define __STATEOS_TRC_H
+
+#include "oskernel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if OS_TRACE_SIZE
+
+/******************************************************************************
+ *
+ * Name              : trace record
+ *
+ ******************************************************************************/
+
+typedef struct __trc
+{
+	uint32_t time;  // time stamp (value of the trace counter)
+	uint16_t code;  // event code (trcSwitch, trcWait, trcWakeup, ...)
+	uint16_t seq;   // sequence number of the record (including lost records)
+	uint32_t obj;   // address of the object
+	uint32_t arg;   // argument of the event
+
+}	trc_t;
+
+/******************************************************************************
+ *
+ * Name              : trc_read
+ * ISR alias         : trc_readISR
+ *
+ * Description       : move records from the kernel trace buffer to the table
+ *
+ * Parameters
+ *   tab             : pointer to the table to store the records
+ *   limit           : size of the table (in number of elements)
+ *
+ * Return            : number of elements stored in the table
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     doesn't lock the kernel; must be used by one reader only
+ *                     the table can be sent directly to the host (e.g. via UART or SWO) and decoded there
+ *
+ ******************************************************************************/
+
+unsigned trc_read( trc_t *tab, unsigned limit );
+
+__STATIC_INLINE
+unsigned trc_readISR( trc_t *tab, unsigned limit ) { return trc_read(tab, limit); }
+
+/******************************************************************************
+ *
+ * Name              : trc_lost
+ * ISR alias         : trc_lostISR
+ *
+ * Description       : return number of records lost because the kernel trace buffer was full
+ *
+ * Parameters        : none
+ *
+ * Return            : number of lost records
+ *
+ * Note              : can be used in both thread and handler mode
+ *
+ ******************************************************************************/
+
+unsigned trc_lost( void );
+
+__STATIC_INLINE
+unsigned trc_lostISR( void ) { return trc_lost(); }
+
+#endif//OS_TRACE_SIZE
+
+#ifdef __cplusplus
+}
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#endif//__STATEOS_TRC_H
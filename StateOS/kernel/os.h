@@ -61,13 +61,22 @@
 #include "inc/osrwlock.h"
 #include "inc/oslist.h"
 #include "inc/osmemorypool.h"
+#include "inc/ostopic.h"
 #include "inc/osstreambuffer.h"
+#include "inc/osbroadcaststream.h"
 #include "inc/osmessagebuffer.h"
+#include "inc/osringbuffer.h"
+#include "inc/osseqlock.h"
 #include "inc/osmailboxqueue.h"
+#include "inc/oschannel.h"
+#include "inc/ospriorityqueue.h"
 #include "inc/oseventqueue.h"
 #include "inc/osjobqueue.h"
+#include "inc/osobjectset.h"
 #include "inc/ostimer.h"
 #include "inc/ostask.h"
+#include "inc/osexecutor.h"
+#include "inc/ostrace.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -98,6 +107,29 @@ void sys_init( void )
 #endif
 }
 
+#if OS_DEFER_SIZE
+
+/******************************************************************************
+ *
+ * Name              : sys_deferOverflow
+ *
+ * Description       : return number of requests of ISR aliases that didn't fit in the deferred services queue
+ *
+ * Parameters        : none
+ *
+ * Return            : number of requests that didn't fit in the deferred services queue since the system start
+ *
+ * Note              : can be used in both thread and handler mode
+ *                     such a request was dropped (its ISR alias returned E_TIMEOUT or nothing),
+ *                     except for lst_giveISR and mem_giveISR, which give the memory object directly then
+ *                     a non-zero value means that OS_DEFER_SIZE is too small
+ *
+ ******************************************************************************/
+
+unsigned sys_deferOverflow( void );
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
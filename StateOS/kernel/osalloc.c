@@ -31,6 +31,20 @@
 
 #include "osalloc.h"
 #include "inc/oscriticalsection.h"
+#if OS_OBJ_CACHE
+#include "inc/osbarrier.h"
+#include "inc/osconditionvariable.h"
+#include "inc/osevent.h"
+#include "inc/osflag.h"
+#include "inc/oslist.h"
+#include "inc/osmutex.h"
+#include "inc/osfastmutex.h"
+#include "inc/osrwlock.h"
+#include "inc/ossemaphore.h"
+#include "inc/ossignal.h"
+#include "inc/ostimer.h"
+#include "inc/ostask.h"
+#endif
 
 /* -------------------------------------------------------------------------- */
 
@@ -49,10 +63,134 @@ seg_t            Heap[SEG_SIZE(OS_HEAP_SIZE)+1] __ALIGNED(sizeof(stk_t));
 
 #endif
 
+/* -------------------------------------------------------------------------- */
+// HEAP STATISTICS
 /* -------------------------------------------------------------------------- */
 
 #if OS_HEAP_SIZE
 
+static  struct
+{
+	size_t   free;                     // total size of free blocks (including headers)
+	size_t   used;                     // total size of used blocks (including headers)
+	size_t   peak;                     // maximum total size of allocated memory segments
+	size_t   largest;                  // size of the largest free block (first-fit allocator only)
+	bool     dirty;                    // the largest free block may have been taken, 'largest' is only an upper bound (first-fit allocator only)
+	unsigned freeBlocks;               // number of free blocks
+	unsigned usedBlocks;               // number of used blocks
+	unsigned failures;                 // number of failed allocations
+	unsigned hist[HPS_CLASSES];        // histogram of free blocks
+
+}	Stats;                             // heap statistics, updated incrementally
+
+/* -------------------------------------------------------------------------- */
+
+static
+unsigned priv_hps_class( size_t size )
+{
+	unsigned cls = 0;
+
+	while ((size >> cls) >= 32 && cls < HPS_CLASSES - 1)
+		cls++;
+
+	return cls;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_hps_insert( size_t size )
+{
+//	free block of given size (including header) has been created
+	Stats.free += size;
+	Stats.freeBlocks++;
+	Stats.hist[priv_hps_class(size)]++;
+
+	if (size >= Stats.largest)
+	{
+		Stats.largest = size;
+		Stats.dirty = false;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_hps_remove( size_t size )
+{
+//	free block of given size (including header) has been removed
+	Stats.free -= size;
+	Stats.freeBlocks--;
+	Stats.hist[priv_hps_class(size)]--;
+
+	if (size == Stats.largest)
+		Stats.dirty = true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_hps_take( size_t size )
+{
+//	used block of given size (including header) has been created
+	Stats.used += size;
+	Stats.usedBlocks++;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_hps_give( size_t size )
+{
+//	used block of given size (including header) has been released
+	Stats.used -= size;
+	Stats.usedBlocks--;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_hps_peak( void )
+{
+	size_t used = Stats.used - Stats.usedBlocks * sizeof(seg_t);
+
+	if (Stats.peak < used)
+		Stats.peak = used;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && (OS_HEAP_TLSF == 0)
+
+static
+size_t priv_seg_size( seg_t *seg )
+{
+	return (uintptr_t)seg->next - (uintptr_t)seg;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_seg_merge( seg_t *seg )
+{
+	seg_t *nxt;
+
+	while (nxt = seg->next, nxt->owner != NULL)
+	{
+	//	it is possible to merge adjacent free memory segments
+		priv_hps_remove(priv_seg_size(nxt));
+		if (seg->owner != NULL)
+			priv_hps_remove(priv_seg_size(seg));
+		seg->next = nxt->next;
+		if (seg->owner != NULL)
+			priv_hps_insert(priv_seg_size(seg));
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
 static
 seg_t *priv_init( void )
 {
@@ -61,6 +199,7 @@ seg_t *priv_init( void )
 	//	system heap must be initialized
 		Heap[0].next  = HeapEnd;
 		Heap[0].owner = Heap;
+		priv_hps_insert(priv_seg_size(Heap));
 	}
 
 	return Heap;
@@ -70,7 +209,7 @@ seg_t *priv_init( void )
 
 /* -------------------------------------------------------------------------- */
 
-#if OS_HEAP_SIZE
+#if OS_HEAP_SIZE && (OS_HEAP_TLSF == 0)
 
 static
 void *priv_alloc( size_t alignment, size_t size )
@@ -86,9 +225,7 @@ void *priv_alloc( size_t alignment, size_t size )
 	//	memory segment has already been allocated
 			continue;
 
-		while (nxt = mem->next, nxt->owner != NULL)
-	//	it is possible to merge adjacent free memory segments
-			mem->next = nxt->next;
+		priv_seg_merge(mem);
 
 		nxt = (seg_t *)ALIGNED_OFFSET(mem, sizeof(seg_t), alignment);
 
@@ -96,12 +233,15 @@ void *priv_alloc( size_t alignment, size_t size )
 	//	memory segment is too small
 			continue;
 
+		priv_hps_remove(priv_seg_size(mem));
+
 		if (nxt > mem)
 		{
 	//	memory segment must be aligned
 			nxt->next  = mem->next;
 	//		nxt->owner = nxt; // updated below (mem->owner = NULL)
 			mem->next  = nxt;
+			priv_hps_insert(priv_seg_size(mem));
 			mem = nxt;
 		}
 
@@ -112,14 +252,20 @@ void *priv_alloc( size_t alignment, size_t size )
 			nxt->next  = mem->next;
 			nxt->owner = nxt;
 			mem->next  = nxt;
+			priv_hps_insert(priv_seg_size(nxt));
 		}
 
 	//	memory segment can be allocated
 		mem->owner = NULL;
+		priv_hps_take(priv_seg_size(mem));
+		priv_hps_peak();
 		mem = mem + 1;
 		break;
 	}
 
+	if (mem == NULL)
+		Stats.failures++;
+
 	return mem;
 }
 
@@ -127,22 +273,29 @@ void *priv_alloc( size_t alignment, size_t size )
 
 /* -------------------------------------------------------------------------- */
 
-#if OS_HEAP_SIZE
+#if OS_HEAP_SIZE && (OS_HEAP_TLSF == 0)
 
 static
 void priv_free( void *ptr )
 {
 	seg_t *mem;
+	seg_t *prv = NULL;
 	seg_t *seg = (seg_t *)ptr - 1;
 
-	for (mem = priv_init(); mem != NULL; mem = mem->next)
+	for (mem = priv_init(); mem != NULL; prv = mem, mem = mem->next)
 	{
 		if (mem != seg)
 	//	this is not the memory segment we are looking for
 			continue;
 
 	//	memory segment can be released
+		priv_hps_give(priv_seg_size(mem));
 		mem->owner = mem;
+		priv_hps_insert(priv_seg_size(mem));
+		priv_seg_merge(mem);
+		if (prv != NULL && prv->owner != NULL)
+	//	merge with the previous free memory segment
+			priv_seg_merge(prv);
 		break;
 	}
 }
@@ -151,7 +304,7 @@ void priv_free( void *ptr )
 
 /* -------------------------------------------------------------------------- */
 
-#if OS_HEAP_SIZE
+#if OS_HEAP_SIZE && (OS_HEAP_TLSF == 0)
 
 static
 void *priv_realloc( void *ptr, size_t size )
@@ -171,9 +324,10 @@ void *priv_realloc( void *ptr, size_t size )
 	//	memory segment is not allocated
 			return NULL;
 
-		while (nxt = mem->next, nxt->owner != NULL)
+		priv_hps_give(priv_seg_size(mem));
+
 	//	it is possible to attach adjacent free memory segment
-			mem->next = nxt->next;
+		priv_seg_merge(mem);
 
 		if (mem + len < mem->next)
 		{
@@ -182,8 +336,12 @@ void *priv_realloc( void *ptr, size_t size )
 			nxt->next  = mem->next;
 			nxt->owner = nxt;
 			mem->next  = nxt;
+			priv_hps_insert(priv_seg_size(nxt));
 		}
 
+		priv_hps_take(priv_seg_size(mem));
+		priv_hps_peak();
+
 		len = (uintptr_t)mem->next - (uintptr_t)mem - sizeof(seg_t);
 		if (len >= size)
 	//	memory segment has been successfully resized
@@ -208,31 +366,437 @@ void *priv_realloc( void *ptr, size_t size )
 
 /* -------------------------------------------------------------------------- */
 
-#if OS_HEAP_SIZE
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && (OS_HEAP_TLSF == 0)
+
+static
+size_t priv_length( void *ptr )
+{
+	seg_t *seg = (seg_t *)ptr - 1;
+
+	return (uintptr_t)seg->next - (uintptr_t)seg - sizeof(seg_t);
+}
+
+/* -------------------------------------------------------------------------- */
 
 static
-size_t priv_size( void )
+size_t priv_largest( void )
 {
 	seg_t *mem;
-	seg_t *nxt;
-	size_t size = 0;
 
-	for (mem = priv_init(); mem != NULL; mem = mem->next)
+	if (Stats.dirty)
 	{
-		if (mem->owner == NULL)
-	//	memory segment has already been allocated
-			continue;
+	//	the largest free block has been taken, find the new one (O(n))
+		Stats.largest = 0;
+		Stats.dirty = false;
+		for (mem = priv_init(); mem != NULL; mem = mem->next)
+			if (mem->owner != NULL && Stats.largest < priv_seg_size(mem))
+				Stats.largest = priv_seg_size(mem);
+	}
 
-		while (nxt = mem->next, nxt->owner != NULL)
-	//	it is possible to merge adjacent free memory segments
-			mem->next = nxt->next;
+	return Stats.largest;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_HEAP_SIZE && OS_HEAP_TLSF
+
+#define LOG2_2( x )  ((x) >= (1UL <<  1) ?  1                      : 0)
+#define LOG2_4( x )  ((x) >= (1UL <<  2) ?  2 + LOG2_2 ((x) >>  2) : LOG2_2 ( x ))
+#define LOG2_8( x )  ((x) >= (1UL <<  4) ?  4 + LOG2_4 ((x) >>  4) : LOG2_4 ( x ))
+#define LOG2_16( x ) ((x) >= (1UL <<  8) ?  8 + LOG2_8 ((x) >>  8) : LOG2_8 ( x ))
+#define LOG2( x )    ((x) >= (1UL << 16) ? 16 + LOG2_16((x) >> 16) : LOG2_16( x ))
+
+#define BLK_FREE      1U                                      // free block flag (bit 0 of block size)
+#define BLK_HDR       sizeof(seg_t)                           // size of header of used block, block alignment
+#define BLK_MIN      (BLK_HDR + sizeof(seg_t))                // minimum size of block (header and links of free block)
+#define SL_BITS       4U
+#define SL_COUNT     (1U << SL_BITS)                          // number of second-level lists in each first-level class
+#define FL_SHIFT     (SL_BITS + LOG2(BLK_HDR))                // blocks smaller than (1 << FL_SHIFT) belong to the first class
+#define FL_COUNT     (LOG2(OS_HEAP_SIZE) - FL_SHIFT + 3)      // number of first-level classes
+
+typedef struct __blk blk_t;
+
+struct __blk
+{
+	blk_t  * phys;  // previous physical block
+	size_t   size;  // size of the block (including header), bit 0 is set if the block is free
+	blk_t  * next;  // next block in the free list (free block only)
+	blk_t  * prev;  // previous block in the free list (free block only)
+};
+
+static  struct
+{
+	uint32_t fl;                       // bitmap of non-empty first-level classes
+	uint32_t sl[FL_COUNT];             // bitmaps of non-empty second-level lists
+	blk_t  * list[FL_COUNT][SL_COUNT]; // free lists
+
+}	Tlsf;                              // two-level segregated fit allocator
+
+/* -------------------------------------------------------------------------- */
+
+static
+unsigned priv_map_msb( size_t map )
+{
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3)
+	return 31U - __CLZ(map);
+#else
+	unsigned bit = 0;
+	while (map >>= 1) bit++;
+	return bit;
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+unsigned priv_map_lsb( uint32_t map )
+{
+	return priv_map_msb(map & (0UL - map));
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+size_t priv_blk_size( blk_t *blk )
+{
+	return blk->size & ~(size_t)BLK_FREE;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+blk_t *priv_blk_next( blk_t *blk )
+{
+	return (blk_t *)((uintptr_t)blk + priv_blk_size(blk));
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+unsigned priv_blk_index( size_t size )
+{
+	unsigned fl;
+	unsigned sl;
+
+	if (size < (1UL << FL_SHIFT))
+	{
+		fl = 0;
+		sl = (unsigned)(size / BLK_HDR);
+	}
+	else
+	{
+		fl = priv_map_msb(size);
+		sl = (unsigned)(size >> (fl - SL_BITS)) ^ SL_COUNT;
+		fl = fl - FL_SHIFT + 1;
+	}
+
+	return fl * SL_COUNT + sl;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_blk_insert( blk_t *blk )
+{
+	unsigned idx = priv_blk_index(priv_blk_size(blk));
+	unsigned fl  = idx / SL_COUNT;
+	unsigned sl  = idx % SL_COUNT;
+	blk_t  * nxt = Tlsf.list[fl][sl];
+
+	priv_hps_insert(priv_blk_size(blk));
+
+	blk->size |= BLK_FREE;
+	blk->prev = NULL;
+	blk->next = nxt;
+	if (nxt != NULL)
+		nxt->prev = blk;
+	Tlsf.list[fl][sl] = blk;
+
+	Tlsf.sl[fl] |= 1UL << sl;
+	Tlsf.fl     |= 1UL << fl;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_blk_remove( blk_t *blk )
+{
+	unsigned idx = priv_blk_index(priv_blk_size(blk));
+	unsigned fl  = idx / SL_COUNT;
+	unsigned sl  = idx % SL_COUNT;
+	blk_t  * prv = blk->prev;
+	blk_t  * nxt = blk->next;
+
+	priv_hps_remove(priv_blk_size(blk));
+
+	blk->size &= ~(size_t)BLK_FREE;
+	if (nxt != NULL)
+		nxt->prev = prv;
+	if (prv != NULL)
+		prv->next = nxt;
+	else
+	if ((Tlsf.list[fl][sl] = nxt) == NULL)
+	{
+		Tlsf.sl[fl] &= ~(1UL << sl);
+		if (Tlsf.sl[fl] == 0)
+			Tlsf.fl &= ~(1UL << fl);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+blk_t *priv_blk_find( size_t size )
+{
+	unsigned idx = priv_blk_index(size);
+	unsigned fl;
+	unsigned sl;
+	uint32_t map;
+	blk_t  * blk;
+
+	if (size >= (1UL << FL_SHIFT))
+	//	round up to the next list, so that each block in the list is large enough
+		idx = priv_blk_index(size + (1UL << (priv_map_msb(size) - SL_BITS)) - 1);
+
+	fl  = idx / SL_COUNT;
+	sl  = idx % SL_COUNT;
+	map = (fl < FL_COUNT) ? Tlsf.sl[fl] & (~0UL << sl) : 0;
+	if (map == 0)
+	{
+		map = (fl + 1 < FL_COUNT) ? Tlsf.fl & (~0UL << (fl + 1)) : 0;
+		if (map == 0)
+		{
+		//	check the first block of the list of the required size
+			idx = priv_blk_index(size);
+			blk = (idx / SL_COUNT < FL_COUNT) ? Tlsf.list[idx / SL_COUNT][idx % SL_COUNT] : NULL;
+			return (blk != NULL && priv_blk_size(blk) >= size) ? blk : NULL;
+		}
+
+		fl  = priv_map_lsb(map);
+		map = Tlsf.sl[fl];
+	}
+
+	return Tlsf.list[fl][priv_map_lsb(map)];
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+blk_t *priv_blk_split( blk_t *blk, size_t size )
+{
+	blk_t *rem = (blk_t *)((uintptr_t)blk + size);
+
+	rem->phys = blk;
+	rem->size = priv_blk_size(blk) - size;
+	blk->size = size;
+	priv_blk_next(rem)->phys = rem;
+
+	return rem;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_blk_merge( blk_t *blk, blk_t *nxt )
+{
+	blk->size += priv_blk_size(nxt);
+	priv_blk_next(blk)->phys = blk;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_init( void )
+{
+	blk_t *blk = (blk_t *)Heap;
+	blk_t *end = (blk_t *)HeapEnd;
+
+	if (blk->size == 0)
+	{
+	//	system heap must be initialized
+		blk->phys = NULL;
+		blk->size = (uintptr_t)end - (uintptr_t)blk;
+		end->phys = blk;
+		end->size = 0; // sentinel, used block of zero size
+		priv_blk_insert(blk);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void *priv_alloc( size_t alignment, size_t size )
+{
+	blk_t *blk;
+	blk_t *nxt;
+	size_t gap = 0;
+	uintptr_t ptr;
+
+	priv_init();
+
+	size = ALIGNED(size, BLK_HDR) + BLK_HDR;
+	if (size < BLK_MIN)
+		size = BLK_MIN;
+
+	if (alignment > BLK_HDR)
+	//	reserve space for a free block before the aligned memory segment
+		gap = alignment + BLK_MIN;
 
-		size += (uintptr_t)mem->next - (uintptr_t)mem - sizeof(seg_t);
+	blk = priv_blk_find(size + gap);
+	if (blk == NULL)
+	{
+	//	there is no large enough free block
+		Stats.failures++;
+		return NULL;
+	}
+
+	priv_blk_remove(blk);
+
+	if (gap)
+	{
+		ptr = ALIGNED((uintptr_t)blk + BLK_HDR, alignment);
+		if (ptr != (uintptr_t)blk + BLK_HDR)
+		{
+			if (ptr - (uintptr_t)blk < BLK_HDR + BLK_MIN)
+				ptr = ALIGNED((uintptr_t)blk + BLK_HDR + BLK_MIN, alignment);
+		//	memory segment must be aligned, the leading part remains free
+			nxt = priv_blk_split(blk, ptr - BLK_HDR - (uintptr_t)blk);
+			priv_blk_insert(blk);
+			blk = nxt;
+		}
+	}
+
+	if (priv_blk_size(blk) >= size + BLK_MIN)
+	//	memory block is larger than required, the trailing part remains free
+		priv_blk_insert(priv_blk_split(blk, size));
+
+	priv_hps_take(priv_blk_size(blk));
+	priv_hps_peak();
+
+	return (void *)((uintptr_t)blk + BLK_HDR);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_free( void *ptr )
+{
+	blk_t *blk = (blk_t *)((uintptr_t)ptr - BLK_HDR);
+	blk_t *nxt = priv_blk_next(blk);
+	blk_t *prv = blk->phys;
+
+	assert((blk->size & BLK_FREE) == 0);
+
+	priv_hps_give(priv_blk_size(blk));
+
+	if (nxt->size & BLK_FREE)
+	{
+	//	merge with the next free block
+		priv_blk_remove(nxt);
+		priv_blk_merge(blk, nxt);
+	}
+
+	if (prv != NULL && (prv->size & BLK_FREE))
+	{
+	//	merge with the previous free block
+		priv_blk_remove(prv);
+		priv_blk_merge(prv, blk);
+		blk = prv;
+	}
+
+	priv_blk_insert(blk);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void *priv_realloc( void *ptr, size_t size )
+{
+	blk_t *blk = (blk_t *)((uintptr_t)ptr - BLK_HDR);
+	blk_t *nxt = priv_blk_next(blk);
+	size_t len = ALIGNED(size, BLK_HDR) + BLK_HDR;
+	void  *mem;
+
+	if (len < BLK_MIN)
+		len = BLK_MIN;
+
+	if (blk->size & BLK_FREE)
+	//	memory segment is not allocated
+		return NULL;
+
+	priv_hps_give(priv_blk_size(blk));
+
+	if (priv_blk_size(blk) < len && (nxt->size & BLK_FREE) && priv_blk_size(blk) + priv_blk_size(nxt) >= len)
+	{
+	//	it is possible to attach the next free block
+		priv_blk_remove(nxt);
+		priv_blk_merge(blk, nxt);
+	}
+
+	if (priv_blk_size(blk) >= len)
+	{
+		if (priv_blk_size(blk) >= len + BLK_MIN)
+		{
+		//	it is possible to reduce the size of the memory segment
+			nxt = priv_blk_split(blk, len);
+			priv_hps_take(priv_blk_size(nxt));
+			priv_free((uint8_t *)nxt + BLK_HDR);
+		}
+		priv_hps_take(priv_blk_size(blk));
+		priv_hps_peak();
+	//	memory segment has been successfully resized
+		return ptr;
+	}
+
+	priv_hps_take(priv_blk_size(blk));
+
+	mem = priv_alloc(sizeof(stk_t), size);
+
+	if (mem != NULL)
+	{
+	//	new memory segment has been successfully allocated
+		memcpy(mem, ptr, priv_blk_size(blk) - BLK_HDR);
+		priv_free(ptr);
+	}
+
+	return mem;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+size_t priv_largest( void )
+{
+	unsigned fl;
+	blk_t  * blk;
+	size_t   size = 0;
+
+	if (Tlsf.fl != 0)
+	{
+	//	the largest free block is in the last non-empty list
+		fl = priv_map_msb(Tlsf.fl);
+		for (blk = Tlsf.list[fl][priv_map_msb(Tlsf.sl[fl])]; blk != NULL; blk = blk->next)
+			if (size < priv_blk_size(blk))
+				size = priv_blk_size(blk);
 	}
 
 	return size;
 }
 
+/* -------------------------------------------------------------------------- */
+
+static
+size_t priv_length( void *ptr )
+{
+	blk_t *blk = (blk_t *)((uintptr_t)ptr - BLK_HDR);
+
+	return priv_blk_size(blk) - BLK_HDR;
+}
+
 #endif
 
 /* -------------------------------------------------------------------------- */
@@ -433,6 +997,196 @@ void aligned_free( void *ptr )
 
 #endif
 
+/* -------------------------------------------------------------------------- */
+// OBJECT CACHES
+/* -------------------------------------------------------------------------- */
+
+#if OS_OBJ_CACHE
+
+#ifndef OS_CACHE_BAR
+#define OS_CACHE_BAR       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_CND
+#define OS_CACHE_CND       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_EVT
+#define OS_CACHE_EVT       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_FLG
+#define OS_CACHE_FLG       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_LST
+#define OS_CACHE_LST       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_MTX
+#define OS_CACHE_MTX       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_MUT
+#define OS_CACHE_MUT       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_RWL
+#define OS_CACHE_RWL       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_SEM
+#define OS_CACHE_SEM       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_SIG
+#define OS_CACHE_SIG       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_TMR
+#define OS_CACHE_TMR       OS_OBJ_CACHE
+#endif
+
+#ifndef OS_CACHE_TSK
+#define OS_CACHE_TSK       OS_OBJ_CACHE
+#endif
+
+#define  CHE_SIZE( size ) \
+     ALIGNED_SIZE( size, sizeof(stk_t) )
+
+#define CHE_BAR_SIZE    CHE_SIZE(sizeof(bar_t))
+#define CHE_CND_SIZE    CHE_SIZE(sizeof(cnd_t))
+#define CHE_EVT_SIZE    CHE_SIZE(sizeof(evt_t))
+#define CHE_FLG_SIZE    CHE_SIZE(sizeof(flg_t))
+#define CHE_LST_SIZE    CHE_SIZE(sizeof(lst_t))
+#define CHE_MTX_SIZE    CHE_SIZE(sizeof(mtx_t))
+#define CHE_MUT_SIZE    CHE_SIZE(sizeof(mut_t))
+#define CHE_RWL_SIZE    CHE_SIZE(sizeof(rwl_t))
+#define CHE_SEM_SIZE    CHE_SIZE(sizeof(sem_t))
+#define CHE_SIG_SIZE    CHE_SIZE(sizeof(sig_t))
+#define CHE_TMR_SIZE    CHE_SIZE(sizeof(tmr_t))
+#define CHE_TSK_SIZE    CHE_SIZE(sizeof(tsk_t) + STK_OVER(OS_STACK_SIZE))
+
+#define CHE_BAR_END    (OS_CACHE_BAR * CHE_BAR_SIZE)
+#define CHE_CND_END    (CHE_BAR_END + OS_CACHE_CND * CHE_CND_SIZE)
+#define CHE_EVT_END    (CHE_CND_END + OS_CACHE_EVT * CHE_EVT_SIZE)
+#define CHE_FLG_END    (CHE_EVT_END + OS_CACHE_FLG * CHE_FLG_SIZE)
+#define CHE_LST_END    (CHE_FLG_END + OS_CACHE_LST * CHE_LST_SIZE)
+#define CHE_MTX_END    (CHE_LST_END + OS_CACHE_MTX * CHE_MTX_SIZE)
+#define CHE_MUT_END    (CHE_MTX_END + OS_CACHE_MUT * CHE_MUT_SIZE)
+#define CHE_RWL_END    (CHE_MUT_END + OS_CACHE_RWL * CHE_RWL_SIZE)
+#define CHE_SEM_END    (CHE_RWL_END + OS_CACHE_SEM * CHE_SEM_SIZE)
+#define CHE_SIG_END    (CHE_SEM_END + OS_CACHE_SIG * CHE_SIG_SIZE)
+#define CHE_TMR_END    (CHE_SIG_END + OS_CACHE_TMR * CHE_TMR_SIZE)
+#define CHE_TSK_END    (CHE_TMR_END + OS_CACHE_TSK * CHE_TSK_SIZE)
+
+typedef struct __che che_t;
+
+struct __che
+{
+	void   * list;   // list of released objects
+	stk_t  * next;   // first object that has never been taken from the cache
+	stk_t  * data;   // beginning of the cache buffer
+	stk_t  * end;    // end of the cache buffer
+	size_t   size;   // size of the cache object (in sizeof(stk_t) units)
+	unsigned count;  // number of objects currently taken from the cache
+	unsigned hits;   // number of allocations served by the cache
+	unsigned misses; // number of allocations served by the heap memory
+};
+
+#define _CHE_INIT( _end, _limit, _size ) \
+       { NULL, CheBuf + (_end) - (_limit) * (_size), CheBuf + (_end) - (_limit) * (_size), CheBuf + (_end), (_size), 0, 0, 0 }
+
+static
+stk_t CheBuf[CHE_TSK_END] __STKALIGN;
+
+static
+che_t Cache[cacheTypes] =
+{
+	_CHE_INIT(CHE_BAR_END, OS_CACHE_BAR, CHE_BAR_SIZE),
+	_CHE_INIT(CHE_CND_END, OS_CACHE_CND, CHE_CND_SIZE),
+	_CHE_INIT(CHE_EVT_END, OS_CACHE_EVT, CHE_EVT_SIZE),
+	_CHE_INIT(CHE_FLG_END, OS_CACHE_FLG, CHE_FLG_SIZE),
+	_CHE_INIT(CHE_LST_END, OS_CACHE_LST, CHE_LST_SIZE),
+	_CHE_INIT(CHE_MTX_END, OS_CACHE_MTX, CHE_MTX_SIZE),
+	_CHE_INIT(CHE_MUT_END, OS_CACHE_MUT, CHE_MUT_SIZE),
+	_CHE_INIT(CHE_RWL_END, OS_CACHE_RWL, CHE_RWL_SIZE),
+	_CHE_INIT(CHE_SEM_END, OS_CACHE_SEM, CHE_SEM_SIZE),
+	_CHE_INIT(CHE_SIG_END, OS_CACHE_SIG, CHE_SIG_SIZE),
+	_CHE_INIT(CHE_TMR_END, OS_CACHE_TMR, CHE_TMR_SIZE),
+	_CHE_INIT(CHE_TSK_END, OS_CACHE_TSK, CHE_TSK_SIZE),
+};
+
+/* -------------------------------------------------------------------------- */
+
+static
+che_t *priv_che_find( void *ptr )
+{
+	che_t *che;
+
+	if ((stk_t *)ptr >= CheBuf && (stk_t *)ptr < CheBuf + CHE_TSK_END)
+		for (che = Cache; che < Cache + cacheTypes; che++)
+			if ((stk_t *)ptr < che->end)
+				return che;
+
+	return NULL;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void *core_obj_alloc( unsigned type, size_t size )
+{
+	che_t *che = &Cache[type];
+	void  *ptr = NULL;
+
+	assert(type < cacheTypes);
+
+	if (size > che->size * sizeof(stk_t))
+	// object does not fit in the cache
+		return malloc(size);
+
+	if (che->list != NULL)
+	{
+		ptr = che->list;
+		che->list = *(void **)ptr;
+	}
+	else
+	if (che->next < che->end)
+	{
+		ptr = che->next;
+		che->next += che->size;
+	}
+
+	if (ptr == NULL)
+	{
+		che->misses++;
+		return malloc(size);
+	}
+
+	che->count++;
+	che->hits++;
+	return ptr;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_obj_free( void *ptr )
+{
+	che_t *che = priv_che_find(ptr);
+
+	if (che == NULL)
+	{
+		free(ptr);
+		return;
+	}
+
+	*(void **)ptr = che->list;
+	che->list = ptr;
+	che->count--;
+}
+
+#endif//OS_OBJ_CACHE
+
 /* -------------------------------------------------------------------------- */
 // SYSTEM HEAP SERVICES
 /* -------------------------------------------------------------------------- */
@@ -447,7 +1201,8 @@ size_t sys_heapSize( void )
 	{
 		core_tsk_deleter();
 #if OS_HEAP_SIZE
-		size = priv_size();
+		priv_init();
+		size = Stats.free - Stats.freeBlocks * sizeof(seg_t);
 #else
 		size = 0;
 #endif
@@ -467,13 +1222,20 @@ size_t sys_segSize( void *ptr )
 
 	sys_lock();
 	{
+#if OS_OBJ_CACHE
+		che_t *che = priv_che_find(ptr);
+		if (che != NULL)
+			size = che->size * sizeof(stk_t);
+		else
+#endif
+		{
 #if OS_HEAP_SIZE
-		seg_t *seg = (seg_t *)ptr - 1;
-		size = (uintptr_t)seg->next - (uintptr_t)seg - sizeof(seg_t);
+			size = priv_length(ptr);
 #else
-		(void) ptr;
-		size = 0;
+			(void) ptr;
+			size = 0;
 #endif
+		}
 	}
 	sys_unlock();
 
@@ -481,3 +1243,63 @@ size_t sys_segSize( void *ptr )
 }
 
 /* -------------------------------------------------------------------------- */
+
+void sys_heapStats( hps_t *hps )
+{
+	unsigned cls;
+
+	assert_tsk_context();
+	assert(hps);
+
+	sys_lock();
+	{
+		core_tsk_deleter();
+#if OS_HEAP_SIZE
+		priv_init();
+		hps->size       = (uintptr_t)HeapEnd - (uintptr_t)Heap;
+		hps->free       = Stats.free - Stats.freeBlocks * sizeof(seg_t);
+		hps->used       = Stats.used - Stats.usedBlocks * sizeof(seg_t);
+		hps->peak       = Stats.peak;
+		hps->largest    = priv_largest();
+		hps->largest   -= hps->largest ? sizeof(seg_t) : 0;
+		hps->freeBlocks = Stats.freeBlocks;
+		hps->usedBlocks = Stats.usedBlocks;
+		hps->failures   = Stats.failures;
+		for (cls = 0; cls < HPS_CLASSES; cls++)
+			hps->hist[cls] = Stats.hist[cls];
+#else
+		memset(hps, 0, sizeof(hps_t));
+		(void) cls;
+#endif
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void sys_cacheStats( unsigned type, chs_t *chs )
+{
+	assert_tsk_context();
+	assert(type < cacheTypes);
+	assert(chs);
+
+	sys_lock();
+	{
+#if OS_OBJ_CACHE
+		che_t *che = &Cache[type];
+		chs->limit  = (unsigned)((che->end - che->data) / che->size);
+		chs->count  = che->count;
+		chs->hits   = che->hits;
+		chs->misses = che->misses;
+#else
+		(void) type;
+		chs->limit  = 0;
+		chs->count  = 0;
+		chs->hits   = 0;
+		chs->misses = 0;
+#endif
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
@@ -52,6 +52,46 @@ struct __seg
 	seg_t  * owner; // owner of memory block (used as free / occupied flag)
 };
 
+/******************************************************************************
+ *
+ * Name              : heap statistics
+ *
+ ******************************************************************************/
+
+#define HPS_CLASSES  16 // number of size classes in the histogram of free blocks
+
+typedef struct __hps hps_t;
+
+struct __hps
+{
+	size_t   size;       // total size of the dedicated heap memory
+	size_t   free;       // total size of free blocks
+	size_t   used;       // total size of allocated memory segments
+	size_t   peak;       // maximum total size of allocated memory segments
+	size_t   largest;    // size of the largest free block (the largest memory segment that can be allocated)
+	unsigned freeBlocks; // number of free blocks
+	unsigned usedBlocks; // number of allocated memory segments
+	unsigned failures;   // number of failed allocations
+	unsigned hist[HPS_CLASSES]; // hist[i]: number of free blocks of size (including header) in range [16 << i, 32 << i),
+	                            // hist[0] includes also smaller blocks, hist[HPS_CLASSES-1] includes also larger blocks
+};
+
+/******************************************************************************
+ *
+ * Name              : object cache statistics
+ *
+ ******************************************************************************/
+
+typedef struct __chs chs_t;
+
+struct __chs
+{
+	unsigned limit;  // number of objects preallocated in the cache
+	unsigned count;  // number of objects currently taken from the cache
+	unsigned hits;   // number of allocations served by the cache
+	unsigned misses; // number of allocations served by the heap memory because the cache was exhausted
+};
+
 /******************************************************************************
  *
  * Alias             : sys_malloc
@@ -124,6 +164,49 @@ size_t sys_heapSize( void );
 
 size_t sys_segSize( void *ptr );
 
+/******************************************************************************
+ *
+ * Name              : sys_heapStats
+ *
+ * Description       : get statistics of the dedicated heap memory (OS_HEAP_SIZE)
+ *
+ * Parameters
+ *   hps             : pointer to the structure that receives the statistics
+ *
+ * Return            : none
+ *
+ * Note              : statistics are updated incrementally by the allocator, so the query takes constant time,
+ *                     except for the largest free block, which is found by the query:
+ *                     with the first-fit allocator it walks the whole heap (O(n)) if the largest free block
+ *                     has been taken since the last query, with the TLSF allocator it walks one free list
+ *                     fragmentation of the heap can be estimated as 1 - largest / free
+ *                     all the statistics are zero if there is no dedicated heap memory
+ *                     use only in thread mode
+ *
+ ******************************************************************************/
+
+void sys_heapStats( hps_t *hps );
+
+/******************************************************************************
+ *
+ * Name              : sys_cacheStats
+ *
+ * Description       : get statistics of the object cache of given type (OS_OBJ_CACHE)
+ *
+ * Parameters
+ *   type            : type of cached objects: cacheBAR, cacheCND, cacheEVT, cacheFLG, cacheLST, cacheMTX,
+ *                     cacheMUT, cacheRWL, cacheSEM, cacheSIG, cacheTMR, cacheTSK
+ *   chs             : pointer to the structure that receives the statistics
+ *
+ * Return            : none
+ *
+ * Note              : all the statistics are zero if object caches are disabled
+ *                     use only in thread mode
+ *
+ ******************************************************************************/
+
+void sys_cacheStats( unsigned type, chs_t *chs );
+
 /* -------------------------------------------------------------------------- */
 
 #ifdef __cplusplus
@@ -66,12 +66,148 @@ extern "C" {
 #define OS_ATOMICS        0
 #endif
 
+/* -------------------------------------------------------------------------- */
+// OS_DEFER_SIZE == 0 => ISR aliases of kernel services are executed immediately in the interrupt handler
+// OS_DEFER_SIZE >  0 => ISR aliases of signalling services only post a request to the deferred services queue,
+//                       requests are executed by the context switch handler (PendSV) in the critical section,
+//                       OS_DEFER_SIZE indicates the size of the queue and must be a power of 2 (at least 2),
+//                       request is dropped if the queue is full (ISR aliases returning a value return E_TIMEOUT),
+//                       dropped requests are counted (sys_deferOverflow),
+//                       lst_giveISR and mem_giveISR never drop the memory object, they give it directly if the queue is full,
+//                       other deferred ISR aliases don't touch kernel queues, so they can also be used in interrupt handlers
+//                       with priority higher than OS_LOCK_LEVEL
+
+#ifndef OS_DEFER_SIZE
+#define OS_DEFER_SIZE     0
+#endif
+
+#if     (OS_DEFER_SIZE & (OS_DEFER_SIZE - 1)) || (OS_DEFER_SIZE == 1)
+#error  Invalid OS_DEFER_SIZE value!
+#endif
+
+#if     OS_DEFER_SIZE && (OS_ATOMICS == 0)
+#error  OS_DEFER_SIZE requires OS_ATOMICS!
+#endif
+
+/* -------------------------------------------------------------------------- */
+// OS_TASK_STATS == 0 => tasks run-time statistics are not collected
+// OS_TASK_STATS == 1 => run time, number of context switches and time stamp of the last run are collected for each task
+//                       at every context switch, DWT cycle counter is used if available, otherwise system timer
+
+#ifndef OS_TASK_STATS
+#define OS_TASK_STATS     0
+#endif
+
+/* -------------------------------------------------------------------------- */
+// OS_TRACE_SIZE == 0 => kernel events are not traced
+// OS_TRACE_SIZE >  0 => kernel events (context switches, blocking and resuming of tasks, expiration of timers,
+//                       take / give operations of ipc objects) are recorded in the trace buffer as fixed-size records,
+//                       OS_TRACE_SIZE indicates number of records in the buffer and must be a power of 2,
+//                       records are lost (and counted) if the buffer is full,
+//                       DWT cycle counter is used for time stamps if available, otherwise system timer
+
+#ifndef OS_TRACE_SIZE
+#define OS_TRACE_SIZE     0
+#endif
+
+#if     (OS_TRACE_SIZE & (OS_TRACE_SIZE - 1))
+#error  Invalid OS_TRACE_SIZE value!
+#endif
+
+/* -------------------------------------------------------------------------- */
+// OS_FAST_PATH == 0 => semaphores, fast mutexes and flags are always updated in the critical section
+// OS_FAST_PATH == 1 => uncontended take / give of semaphores, lock / unlock of fast mutexes and give of flags
+//                      update the object with atomic operations without masking interrupts,
+//                      the critical section is entered only when a task is waiting or has to block,
+//                      enabled by default with OS_ATOMICS when kernel events are not traced
+
+#ifndef OS_FAST_PATH
+#define OS_FAST_PATH     (OS_ATOMICS && (OS_TRACE_SIZE == 0))
+#endif
+
+#if     OS_FAST_PATH && (OS_ATOMICS == 0)
+#error  OS_FAST_PATH requires OS_ATOMICS!
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #ifndef OS_TASK_EXIT
 #define OS_TASK_EXIT      0
 #endif
 
+/* -------------------------------------------------------------------------- */
+// OS_PRIO_LEVELS == 0 => tasks READY queue is a single list sorted by priority
+// OS_PRIO_LEVELS >  0 => tasks READY queue is a set of lists (one list per priority level) indexed by bitmap,
+//                        OS_PRIO_LEVELS indicates number of priority levels,
+//                        all priorities greater than or equal to (OS_PRIO_LEVELS - 1) share the highest level
+
+#ifndef OS_PRIO_LEVELS
+#define OS_PRIO_LEVELS    0
+#endif
+
+#if     OS_PRIO_LEVELS > 1024
+#error  Invalid OS_PRIO_LEVELS value!
+#endif
+
+/* -------------------------------------------------------------------------- */
+// OS_TIMER_WHEEL == 0 => timers queue is a single list sorted by expiration time
+// OS_TIMER_WHEEL == 1 => timers queue is a hierarchical timing wheel (32 slots per level),
+//                        insertion and removal of a timer take constant time
+
+#ifndef OS_TIMER_WHEEL
+#define OS_TIMER_WHEEL    0
+#endif
+
+/* -------------------------------------------------------------------------- */
+// OS_HEAP_TLSF == 0 => dedicated heap memory (OS_HEAP_SIZE) is managed by the first-fit allocator
+// OS_HEAP_TLSF == 1 => dedicated heap memory (OS_HEAP_SIZE) is managed by the two-level segregated fit (TLSF) allocator,
+//                      allocation and release of memory take bounded (constant) time
+
+#ifndef OS_HEAP_TLSF
+#define OS_HEAP_TLSF      0
+#endif
+
+/* -------------------------------------------------------------------------- */
+// OS_OBJ_CACHE == 0 => objects created with xxx_create functions are allocated directly from the heap memory
+// OS_OBJ_CACHE >  0 => number of objects of each type preallocated in the static object caches,
+//                      xxx_create functions take objects from the cache of given type in constant time
+//                      and fall back to the heap memory when the cache is exhausted,
+//                      the number of objects can be changed for each type separately
+//                      (OS_CACHE_BAR, OS_CACHE_CND, OS_CACHE_EVT, OS_CACHE_FLG, OS_CACHE_LST, OS_CACHE_MTX,
+//                       OS_CACHE_MUT, OS_CACHE_RWL, OS_CACHE_SEM, OS_CACHE_SIG, OS_CACHE_TMR, OS_CACHE_TSK),
+//                      the task cache holds only tasks with stack size not greater than OS_STACK_SIZE
+
+#ifndef OS_OBJ_CACHE
+#define OS_OBJ_CACHE      0
+#endif
+
+/* -------------------------------------------------------------------------- */
+// OS_OBJ_SET == 0 => a task can wait only for a single object
+// OS_OBJ_SET == 1 => object header contains a pointer to the object set the object belongs to,
+//                    a task can wait on the object set until any of its members becomes ready
+//                    (semaphore, flag, mailbox queue, event queue, priority queue, stream buffer, message buffer)
+
+#ifndef OS_OBJ_SET
+#define OS_OBJ_SET        0
+#endif
+
+/* -------------------------------------------------------------------------- */
+// OS_TICK_SUPPRESS == 0 => in non-tick-less mode the system timer generates interrupts with frequency OS_FREQUENCY all the time
+// OS_TICK_SUPPRESS == 1 => in non-tick-less mode the idle task suppresses interrupts of the system timer
+//                          until the next event of the timers queue and sleeps,
+//                          the system counter is updated with elapsed ticks after wake-up
+// OS_TICK_SUPPRESS == 2 => as above, but the idle task enters deep sleep,
+//                          the system timer must be clocked in deep sleep mode
+// OS_TICK_SUPPRESS is ignored in tick-less mode
+
+#ifndef OS_TICK_SUPPRESS
+#define OS_TICK_SUPPRESS  0
+#endif
+
+#if     OS_TICK_SUPPRESS > 2
+#error  Invalid OS_TICK_SUPPRESS value!
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 #ifndef OS_GUARD_SIZE
@@ -163,10 +299,18 @@ typedef struct __obj
 {
 	tsk_t  * queue; // next process in the BLOCKED queue
 	void   * res;   // allocated object's resource
+#if OS_OBJ_SET
+	struct __set *
+	         set;   // object set the object belongs to
+#endif
 
 }	obj_t;
 
+#if OS_OBJ_SET
+#define               _OBJ_INIT() { NULL, NULL, NULL }
+#else
 #define               _OBJ_INIT() { NULL, NULL }
+#endif
 
 /* -------------------------------------------------------------------------- */
 
@@ -185,10 +329,17 @@ typedef struct __hdr
 	void   * prev;  // previous object (timer / task) in the READY queue
 	void   * next;  // next object (timer / task) in the READY queue
 	tid_t    id;    // timer / task id
+#if OS_TIMER_WHEEL
+	unsigned slot;  // slot of the timing wheel
+#endif
 
 }	hdr_t;
 
+#if OS_TIMER_WHEEL
+#define               _HDR_INIT() { NULL, NULL, ID_STOPPED, 0 }
+#else
 #define               _HDR_INIT() { NULL, NULL, ID_STOPPED }
+#endif
 
 /* -------------------------------------------------------------------------- */
 
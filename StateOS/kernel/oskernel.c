@@ -47,6 +47,28 @@ void priv_ctx_switchNow( void )
 	port_set_lock();
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_PRIO_LEVELS || OS_TIMER_WHEEL
+
+static
+unsigned priv_map_msb( uint32_t map )
+{
+#if defined(__CORTEX_M) && (__CORTEX_M >= 3)
+	return 31U - __CLZ(map);
+#else
+	unsigned bit = 0;
+	if (map & 0xFFFF0000UL) { map >>= 16; bit += 16; }
+	if (map & 0x0000FF00UL) { map >>=  8; bit +=  8; }
+	if (map & 0x000000F0UL) { map >>=  4; bit +=  4; }
+	if (map & 0x0000000CUL) { map >>=  2; bit +=  2; }
+	if (map & 0x00000002UL) {             bit +=  1; }
+	return bit;
+#endif
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // SYSTEM TIMER SERVICES
 /* -------------------------------------------------------------------------- */
@@ -55,6 +77,8 @@ tmr_t WAIT = { .hdr={ .prev=&WAIT, .next=&WAIT, .id=ID_TIMER }, .delay=INFINITE
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TIMER_WHEEL == 0
+
 static
 void priv_tmr_insert( tmr_t *tmr )
 {
@@ -91,17 +115,10 @@ void priv_tmr_remove( tmr_t *tmr )
 
 /* -------------------------------------------------------------------------- */
 
-void core_tmr_insert( tmr_t *tmr )
-{
-	priv_tmr_insert(tmr);
-	port_tmr_force();
-}
-
-/* -------------------------------------------------------------------------- */
-
-void core_tmr_remove( tmr_t *tmr )
+static
+tmr_t *priv_tmr_head( void )
 {
-	priv_tmr_remove(tmr);
+	return WAIT.hdr.next;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -146,6 +163,358 @@ bool priv_tmr_expired( tmr_t *tmr )
 
 /* -------------------------------------------------------------------------- */
 
+static
+cnt_t priv_tmr_delay( void )
+{
+	tmr_t *tmr = WAIT.hdr.next;
+	cnt_t time = core_sys_time() - tmr->start;
+
+	if (tmr->delay == INFINITE)
+	return INFINITE; // timers queue is empty or timer counting indefinitely
+
+	if (tmr->delay <= time)
+	return 0;        // timer finished counting
+
+	return tmr->delay - time;
+}
+
+/* -------------------------------------------------------------------------- */
+
+tmr_t *core_tmr_next( tmr_t *tmr )
+{
+	return tmr->hdr.next;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#else //OS_TIMER_WHEEL
+
+#define WHL_BITS    5U
+#define WHL_SIZE   (1U << WHL_BITS)                            // number of slots in each level of the wheel
+#define WHL_LEVELS (((OS_TIMER_SIZE) + WHL_BITS - 1) / WHL_BITS) // number of levels of the wheel
+#define WHL_INF    (WHL_LEVELS * WHL_SIZE)                     // list of timers counting indefinitely
+#define WHL_DUE    (WHL_INF + 1)                               // timers queue (WAIT), contains only expired timers
+
+static  struct
+{
+	cnt_t    time;                 // wheel time, all events up to this time have already been handled
+	uint32_t lvl;                  // bitmap of non-empty levels of the wheel
+	uint32_t map[WHL_LEVELS];      // bitmaps of non-empty slots of each level of the wheel
+	tmr_t  * slot[WHL_INF + 1];    // first timer in each slot of the wheel and in the list of timers counting indefinitely
+
+}	Wheel;                         // hierarchical timing wheel
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_whl_link( tmr_t *tmr, unsigned idx )
+{
+	tmr_t *prv;
+	tmr_t *nxt = (idx == WHL_DUE) ? &WAIT : Wheel.slot[idx];
+
+	tmr->hdr.slot = idx;
+
+	if (nxt == NULL)
+	{
+		Wheel.slot[idx] = tmr;
+		if (idx < WHL_INF)
+		{
+			Wheel.map[idx / WHL_SIZE] |= 1UL << (idx % WHL_SIZE);
+			Wheel.lvl |= 1UL << (idx / WHL_SIZE);
+		}
+		tmr->hdr.prev = tmr;
+		tmr->hdr.next = tmr;
+		return;
+	}
+
+	prv = nxt->hdr.prev;
+
+	tmr->hdr.prev = prv;
+	tmr->hdr.next = nxt;
+	nxt->hdr.prev = tmr;
+	prv->hdr.next = tmr;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_whl_unlink( tmr_t *tmr )
+{
+	unsigned idx = tmr->hdr.slot;
+	tmr_t *prv = tmr->hdr.prev;
+	tmr_t *nxt = tmr->hdr.next;
+
+	nxt->hdr.prev = prv;
+	prv->hdr.next = nxt;
+
+	if (idx == WHL_DUE || Wheel.slot[idx] != tmr)
+		return;
+
+	if (nxt != tmr)
+	{
+		Wheel.slot[idx] = nxt;
+		return;
+	}
+
+	Wheel.slot[idx] = NULL;
+	if (idx < WHL_INF)
+	{
+		Wheel.map[idx / WHL_SIZE] &= ~(1UL << (idx % WHL_SIZE));
+		if (Wheel.map[idx / WHL_SIZE] == 0)
+			Wheel.lvl &= ~(1UL << (idx / WHL_SIZE));
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_whl_place( tmr_t *tmr, cnt_t now )
+{
+	cnt_t    time = Wheel.time;
+	cnt_t    delta;
+	cnt_t    level;
+	unsigned lvl;
+
+	if ((cnt_t)(tmr->start - time) <= (cnt_t)(now - time))
+	{
+		delta = tmr->start - time; // timer started after the wheel time
+		delta = (tmr->delay < CNT_MAX - delta) ? delta + tmr->delay : CNT_MAX;
+	}
+	else
+	{
+		delta = time - tmr->start; // timer started before the wheel time
+		delta = (tmr->delay > delta) ? tmr->delay - delta : 0;
+	}
+
+	if (delta == 0)
+	{
+		priv_whl_link(tmr, WHL_DUE);
+		return;
+	}
+
+	for (lvl = 0, level = delta >> WHL_BITS; level; lvl++)
+		level >>= WHL_BITS;
+
+	time += delta;
+	priv_whl_link(tmr, lvl * WHL_SIZE + (unsigned)(time >> (lvl * WHL_BITS)) % WHL_SIZE);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+cnt_t priv_whl_next( void )
+{
+	cnt_t    time = Wheel.time;
+	cnt_t    next = 0;
+	cnt_t    dist;
+	uint32_t lvl  = Wheel.lvl;
+	uint32_t map;
+	unsigned pos;
+	unsigned shift;
+
+	for (shift = 0; lvl; lvl >>= 1, shift += WHL_BITS)
+	{
+		dist = ((cnt_t)1 << shift) - (time & (((cnt_t)1 << shift) - 1));
+		if (next && next <= dist)
+			break; // none of the higher levels can expire earlier
+
+		if (lvl & 1)
+		{
+			pos  = ((unsigned)(time >> shift) + 1) % WHL_SIZE;
+			map  = Wheel.map[shift / WHL_BITS];
+			map  = (map >> pos) | (map << ((WHL_SIZE - pos) % WHL_SIZE));
+			dist = ((time >> shift) + 1 + priv_map_msb(map & (0UL - map))) << shift;
+			dist -= time;
+			if (next == 0 || next > dist)
+				next = dist;
+		}
+	}
+
+	return next;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_whl_cascade( cnt_t now )
+{
+	cnt_t    time = Wheel.time;
+	unsigned lvl  = WHL_LEVELS;
+	unsigned idx;
+	tmr_t  * tmr;
+
+	while (lvl--)
+	{
+		if (time & (((cnt_t)1 << (lvl * WHL_BITS)) - 1))
+			continue;
+
+		idx = lvl * WHL_SIZE + (unsigned)(time >> (lvl * WHL_BITS)) % WHL_SIZE;
+		while ((tmr = Wheel.slot[idx]) != NULL)
+		{
+			priv_whl_unlink(tmr);
+			priv_whl_place(tmr, now);
+		}
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_insert( tmr_t *tmr )
+{
+	cnt_t now = core_sys_time();
+
+	tmr->hdr.id = ID_TIMER;
+
+	if (tmr->delay == INFINITE)
+	{
+		priv_whl_link(tmr, WHL_INF);
+		return;
+	}
+
+	if (Wheel.lvl == 0)
+		Wheel.time = now;
+
+	priv_whl_place(tmr, now);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tmr_remove( tmr_t *tmr )
+{
+	tmr->hdr.id = ID_STOPPED;
+
+	priv_whl_unlink(tmr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+tmr_t *priv_tmr_head( void )
+{
+	cnt_t now;
+	cnt_t next;
+
+	while (WAIT.hdr.next == &WAIT)
+	{
+#if HW_TIMER_SIZE
+		port_tmr_stop();
+#endif
+		next = priv_whl_next();
+		if (next == 0)
+			break; // wheel is empty
+
+		now = core_sys_time();
+		if (next > (cnt_t)(now - Wheel.time))
+		{
+#if HW_TIMER_SIZE
+			port_tmr_start(Wheel.time + next);
+			now = core_sys_time();
+			if (next > (cnt_t)(now - Wheel.time))
+#endif
+			{
+				Wheel.time = now;
+				break; // wheel still counts
+			}
+#if HW_TIMER_SIZE
+			port_tmr_stop();
+#endif
+		}
+
+		Wheel.time += next;
+		priv_whl_cascade(now);
+	}
+
+	return WAIT.hdr.next;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+bool priv_tmr_expired( tmr_t *tmr )
+{
+	return tmr != &WAIT; // timers queue contains only expired timers
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+cnt_t priv_tmr_delay( void )
+{
+	cnt_t next;
+	cnt_t time;
+
+	if (WAIT.hdr.next != &WAIT)
+	return 0;        // timers queue contains expired timers
+
+	next = priv_whl_next();
+	if (next == 0)
+	return INFINITE; // wheel is empty
+
+	time = core_sys_time() - Wheel.time;
+	if (next <= time)
+	return 0;        // next slot of the wheel has to be handled
+
+	return next - time;
+}
+
+/* -------------------------------------------------------------------------- */
+
+tmr_t *core_tmr_next( tmr_t *tmr )
+{
+	unsigned idx = WHL_DUE;
+	tmr_t *nxt = tmr->hdr.next;
+
+	if (tmr != &WAIT)
+		idx = tmr->hdr.slot;
+
+	if (idx == WHL_DUE)
+	{
+		if (nxt != &WAIT)
+			return nxt;
+		idx = 0;
+	}
+	else
+	{
+		if (nxt != Wheel.slot[idx])
+			return nxt;
+		idx++;
+	}
+
+	for (; idx <= WHL_INF; idx++)
+		if (Wheel.slot[idx] != NULL)
+			return Wheel.slot[idx];
+
+	return &WAIT;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_TIMER_WHEEL
+
+void core_tmr_insert( tmr_t *tmr )
+{
+	priv_tmr_insert(tmr);
+	port_tmr_force();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_tmr_remove( tmr_t *tmr )
+{
+	priv_tmr_remove(tmr);
+}
+
+/* -------------------------------------------------------------------------- */
+
+cnt_t core_tmr_delay( void )
+{
+	return priv_tmr_delay();
+}
+
+/* -------------------------------------------------------------------------- */
+
 static
 void priv_tmr_wakeup( tmr_t *tmr, int event )
 {
@@ -167,12 +536,13 @@ void core_tmr_handler( void )
 
 	port_set_lock();
 	{
-		while (priv_tmr_expired(tmr = WAIT.hdr.next))
+		while (priv_tmr_expired(tmr = priv_tmr_head()))
 		{
 			tmr->start += tmr->delay;
 
 			if (tmr->hdr.id == ID_TIMER)
 			{
+				core_trc_put(trcTimer, tmr, tmr->period);
 				tmr->delay = tmr->period;
 				priv_tmr_wakeup(tmr, E_SUCCESS);
 			}
@@ -186,6 +556,92 @@ void core_tmr_handler( void )
 	port_clr_lock();
 }
 
+/* -------------------------------------------------------------------------- */
+// SYSTEM DEFERRED SERVICES
+/* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+#define SRV_LAP( pos ) \
+          ((pos) & ~((OS_DEFER_SIZE) - 1U))
+
+static  struct
+{
+	unsigned head;                 // position of the next request to be posted (atomic)
+	unsigned tail;                 // position of the next request to be executed
+	unsigned over;                 // number of requests that didn't fit in the queue (atomic)
+	struct
+	{
+		unsigned  seq;             // sequence number of the request (atomic)
+		srv_t   * srv;             // deferred service procedure
+		void    * obj;             // first parameter of the service
+		uintptr_t arg;             // second parameter of the service
+	}	rec[OS_DEFER_SIZE];
+
+}	Defer;                         // deferred services queue
+
+/* -------------------------------------------------------------------------- */
+
+int core_srv_defer( srv_t *srv, void *obj, uintptr_t arg )
+{
+	unsigned pos = atomic_load((atomic_uint *)&Defer.head);
+	unsigned seq;
+
+	for (;;)
+	{
+		seq = atomic_load((atomic_uint *)&Defer.rec[pos % OS_DEFER_SIZE].seq);
+		if (seq == SRV_LAP(pos))
+		{
+			if (atomic_compare_exchange_weak((atomic_uint *)&Defer.head, &pos, pos + 1))
+				break; // record reserved
+		}
+		else
+		if ((int)(seq - SRV_LAP(pos)) < 0)
+		{
+			atomic_fetch_add((atomic_uint *)&Defer.over, 1);
+			return E_TIMEOUT; // queue is full, the request is not posted
+		}
+		else
+		{
+			pos = atomic_load((atomic_uint *)&Defer.head);
+		}
+	}
+
+	Defer.rec[pos % OS_DEFER_SIZE].srv = srv;
+	Defer.rec[pos % OS_DEFER_SIZE].obj = obj;
+	Defer.rec[pos % OS_DEFER_SIZE].arg = arg;
+	atomic_store((atomic_uint *)&Defer.rec[pos % OS_DEFER_SIZE].seq, SRV_LAP(pos) + 1);
+
+	port_ctx_switch();
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_srv_handler( void )
+{
+	unsigned pos = Defer.tail;
+
+	while (atomic_load((atomic_uint *)&Defer.rec[pos % OS_DEFER_SIZE].seq) == SRV_LAP(pos) + 1)
+	{
+		Defer.rec[pos % OS_DEFER_SIZE].srv(Defer.rec[pos % OS_DEFER_SIZE].obj, Defer.rec[pos % OS_DEFER_SIZE].arg);
+		atomic_store((atomic_uint *)&Defer.rec[pos % OS_DEFER_SIZE].seq, SRV_LAP(pos) + OS_DEFER_SIZE);
+		Defer.tail = ++pos;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+unsigned sys_deferOverflow( void )
+{
+	return atomic_load((atomic_uint *)&Defer.over);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
 /* -------------------------------------------------------------------------- */
 // SYSTEM TASK SERVICES
 /* -------------------------------------------------------------------------- */
@@ -201,12 +657,27 @@ static  union  { stk_t STK[STK_SIZE(OS_IDLE_STACK)] __STKALIGN;
 #define IDLE_STK  IDLE_STACK.STK
 #define IDLE_SP  &IDLE_STACK.CTX.ctx
 
+#if OS_PRIO_LEVELS == 0
 tsk_t MAIN = { .hdr={ .prev=&IDLE, .next=&IDLE, .id=ID_READY }, .stack=MAIN_TOP, .basic=OS_MAIN_PRIO, .prio=OS_MAIN_PRIO }; // main task
 tsk_t IDLE = { .hdr={ .prev=&MAIN, .next=&MAIN, .id=ID_READY }, .state=core_tsk_idle, .stack=IDLE_STK, .size=sizeof(IDLE_STK), .sp=IDLE_SP, .owner=&IDLE }; // idle task and tasks queue
+#else
+tsk_t MAIN = { .hdr={ .prev=&MAIN, .next=&MAIN, .id=ID_READY }, .stack=MAIN_TOP, .basic=OS_MAIN_PRIO, .prio=OS_MAIN_PRIO }; // main task
+tsk_t IDLE = { .hdr={ .prev=&IDLE, .next=&IDLE, .id=ID_READY }, .state=core_tsk_idle, .stack=IDLE_STK, .size=sizeof(IDLE_STK), .sp=IDLE_SP, .owner=&IDLE }; // idle task
+#endif
 sys_t System = { .cur=&MAIN };
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_PRIO_LEVELS == 0
+
+static
+tsk_t *priv_tsk_head( void )
+{
+	return IDLE.hdr.next;
+}
+
+/* -------------------------------------------------------------------------- */
+
 static
 void priv_tsk_insert( tsk_t *tsk )
 {
@@ -241,11 +712,259 @@ void priv_tsk_remove( tsk_t *tsk )
 
 /* -------------------------------------------------------------------------- */
 
+static
+void priv_tsk_rotate( tsk_t *tsk )
+{
+	priv_tsk_remove(tsk);
+	priv_tsk_insert(tsk);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_cur_prio( tsk_t *cur, unsigned prio )
+{
+	tsk_t *nxt = cur->hdr.next;
+
+	cur->prio = prio;
+	if (nxt->prio > prio)
+		port_ctx_switch();
+}
+
+/* -------------------------------------------------------------------------- */
+
+tsk_t *core_tsk_next( tsk_t *tsk )
+{
+	return tsk->hdr.next;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#else //OS_PRIO_LEVELS
+
+#define PRIO_LEVEL( prio ) \
+          ((prio) < (OS_PRIO_LEVELS) ? (prio) : (OS_PRIO_LEVELS) - 1U)
+
+#define PRIO_WORDS \
+          (((OS_PRIO_LEVELS) + 31) / 32)
+
+#define MAIN_LEVEL \
+           PRIO_LEVEL(OS_MAIN_PRIO)
+
+static  struct
+{
+	tsk_t  * head[OS_PRIO_LEVELS]; // first task in the READY queue of each priority level
+#if OS_PRIO_LEVELS > 32
+	uint32_t grp;                  // bitmap of non-empty words of the priority map
+#endif
+	uint32_t map[PRIO_WORDS];      // bitmap of non-empty priority levels
+
+}	Ready = { .head={ [MAIN_LEVEL]=&MAIN },
+#if OS_PRIO_LEVELS > 32
+	          .grp=1UL<<(MAIN_LEVEL/32),
+#endif
+	          .map={ [MAIN_LEVEL/32]=1UL<<(MAIN_LEVEL%32) } }; // tasks queues
+
+/* -------------------------------------------------------------------------- */
+
+
+static
+void priv_map_set( unsigned lvl )
+{
+#if OS_PRIO_LEVELS > 32
+	Ready.grp |= 1UL << (lvl / 32);
+#endif
+	Ready.map[lvl / 32] |= 1UL << (lvl % 32);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_map_clr( unsigned lvl )
+{
+	Ready.map[lvl / 32] &= ~(1UL << (lvl % 32));
+#if OS_PRIO_LEVELS > 32
+	if (Ready.map[lvl / 32] == 0)
+		Ready.grp &= ~(1UL << (lvl / 32));
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+tsk_t *priv_tsk_head( void )
+{
+#if OS_PRIO_LEVELS > 32
+	unsigned idx;
+
+	if (Ready.grp == 0)
+		return &IDLE;
+
+	idx = priv_map_msb(Ready.grp);
+	return Ready.head[idx * 32 + priv_map_msb(Ready.map[idx])];
+#else
+	if (Ready.map[0] == 0)
+		return &IDLE;
+
+	return Ready.head[priv_map_msb(Ready.map[0])];
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_prio_insert( tsk_t *tsk )
+{
+	tsk_t *prv;
+	unsigned lvl = PRIO_LEVEL(tsk->prio);
+	tsk_t *nxt = Ready.head[lvl];
+
+	if (nxt == NULL)
+	{
+		tsk->hdr.prev = tsk;
+		tsk->hdr.next = tsk;
+		Ready.head[lvl] = tsk;
+		priv_map_set(lvl);
+	}
+	else
+	{
+		prv = nxt->hdr.prev;
+
+		tsk->hdr.prev = prv;
+		tsk->hdr.next = nxt;
+		nxt->hdr.prev = tsk;
+		prv->hdr.next = tsk;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_prio_remove( tsk_t *tsk )
+{
+	unsigned lvl = PRIO_LEVEL(tsk->prio);
+	tsk_t *prv = tsk->hdr.prev;
+	tsk_t *nxt = tsk->hdr.next;
+
+	if (nxt == tsk)
+	{
+		Ready.head[lvl] = NULL;
+		priv_map_clr(lvl);
+	}
+	else
+	{
+		nxt->hdr.prev = prv;
+		prv->hdr.next = nxt;
+
+		if (Ready.head[lvl] == tsk)
+			Ready.head[lvl] = nxt;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_insert( tsk_t *tsk )
+{
+#if OS_ROBIN && HW_TIMER_SIZE == 0
+	tsk->slice = 0;
+#endif
+	priv_prio_insert(tsk);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_remove( tsk_t *tsk )
+{
+	priv_prio_remove(tsk);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tsk_rotate( tsk_t *tsk )
+{
+	if (tsk == &IDLE)
+		return;
+#if OS_ROBIN && HW_TIMER_SIZE == 0
+	tsk->slice = 0;
+#endif
+	Ready.head[PRIO_LEVEL(tsk->prio)] = tsk->hdr.next;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_cur_prio( tsk_t *cur, unsigned prio )
+{
+	tsk_t *nxt;
+
+	if (cur->hdr.id == ID_READY && cur->guard == 0)
+	{
+		priv_prio_remove(cur);
+		cur->prio = prio;
+		priv_prio_insert(cur);
+
+		nxt = priv_tsk_head();
+		if (PRIO_LEVEL(nxt->prio) == PRIO_LEVEL(prio))
+	//	the current task remains the first one in the READY queue
+			Ready.head[PRIO_LEVEL(prio)] = cur;
+	}
+	else
+	{
+		cur->prio = prio;
+	}
+
+	if (cur != priv_tsk_head())
+		port_ctx_switch();
+}
+
+/* -------------------------------------------------------------------------- */
+
+tsk_t *core_tsk_next( tsk_t *tsk )
+{
+	unsigned lvl;
+	unsigned idx;
+	uint32_t map;
+
+	if (tsk == &IDLE)
+		return priv_tsk_head();
+
+	lvl = PRIO_LEVEL(tsk->prio);
+	if (tsk->hdr.next != Ready.head[lvl])
+		return tsk->hdr.next;
+
+	idx = lvl / 32;
+	map = Ready.map[idx] & ((1UL << (lvl % 32)) - 1);
+#if OS_PRIO_LEVELS > 32
+	if (map == 0)
+	{
+		map = Ready.grp & ((1UL << idx) - 1);
+		if (map == 0)
+			return &IDLE;
+
+		idx = priv_map_msb(map);
+		map = Ready.map[idx];
+	}
+#else
+	if (map == 0)
+		return &IDLE;
+#endif
+	return Ready.head[idx * 32 + priv_map_msb(map)];
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_PRIO_LEVELS
+
+/* -------------------------------------------------------------------------- */
+
 void core_tsk_insert( tsk_t *tsk )
 {
 	tsk->hdr.id = ID_READY;
 	priv_tsk_insert(tsk);
-	if (tsk == IDLE.hdr.next)
+	if (tsk == priv_tsk_head())
 		port_ctx_switch();
 }
 
@@ -318,9 +1037,13 @@ bool core_stk_integrity( void )
 
 void core_ctx_switch( void )
 {
-	tsk_t *cur = IDLE.hdr.next;
+	tsk_t *cur = priv_tsk_head();
 	tsk_t *nxt = cur->hdr.next;
+#if OS_PRIO_LEVELS == 0
 	if (nxt->prio == cur->prio)
+#else
+	if (nxt != cur)
+#endif
 		port_ctx_switch();
 }
 
@@ -391,12 +1114,26 @@ void core_tsk_transfer( tsk_t *tsk, tsk_t **que )
 
 /* -------------------------------------------------------------------------- */
 
+void core_tsk_rewind( tsk_t *tsk )
+{
+	if (tsk->delay != INFINITE)
+	{
+		priv_tmr_remove((tmr_t *)tsk);
+		tsk->start = core_sys_time();
+		core_tmr_insert((tmr_t *)tsk); // sets ID_TIMER for a while
+		tsk->hdr.id = ID_READY;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
 int core_tsk_wait( tsk_t *tsk, tsk_t **que )
 {
 	assert_tsk_context();
 
 	if (que)
 	{
+		core_trc_put(trcWait, tsk, (uintptr_t)que);
 		priv_tsk_remove(tsk);
 		core_tmr_insert((tmr_t *)tsk); // sets ID_TIMER for a while
 		core_tsk_append(tsk, que);     // must be last; sets ID_READY back
@@ -467,6 +1204,7 @@ tsk_t *core_tsk_wakeup( tsk_t *tsk, int event )
 {
 	if (tsk)
 	{
+		core_trc_put(trcWakeup, tsk, (uintptr_t)event);
 		core_tsk_unlink(tsk, event);
 		priv_tmr_remove((tmr_t *)tsk);
 		core_tsk_insert(tsk);
@@ -509,17 +1247,14 @@ void core_tsk_prio( tsk_t *tsk, unsigned prio )
 
 	if (tsk->prio != prio)
 	{
-		tsk->prio = prio;
-
 		if (tsk == System.cur)       // current task
 		{
-			tsk = tsk->hdr.next;
-			if (tsk->prio > prio)
-				port_ctx_switch();
+			priv_cur_prio(tsk, prio);
 		}
 		else
 		if (tsk->guard != 0)         // blocked task
 		{
+			tsk->prio = prio;
 			core_tsk_transfer(tsk, tsk->guard);
 			if (tsk->mtx.tree)
 				core_tsk_prio(tsk->mtx.tree->owner, prio);
@@ -528,8 +1263,13 @@ void core_tsk_prio( tsk_t *tsk, unsigned prio )
 		if (tsk->hdr.id == ID_READY) // ready task
 		{
 			priv_tsk_remove(tsk);
+			tsk->prio = prio;
 			core_tsk_insert(tsk);
 		}
+		else                         // inactive task
+		{
+			tsk->prio = prio;
+		}
 	}
 }
 
@@ -550,15 +1290,31 @@ void core_cur_prio( unsigned prio )
 
 	if (tsk->prio != prio)
 	{
-		tsk->prio = prio;
-		tsk = tsk->hdr.next;
-		if (tsk->prio > prio)
-			port_ctx_switch();
+		priv_cur_prio(tsk, prio);
 	}
 }
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_TASK_STATS
+
+static
+void priv_tsk_stats( tsk_t *cur, tsk_t *nxt )
+{
+	uint32_t now  = core_sts_time();
+	cnt_t    tick = core_sys_time();
+
+	cur->sts.cycles += core_sts_delta(now, tick, cur->sts.last, cur->sts.time);
+	nxt->sts.last = now;
+	nxt->sts.time = tick;
+	if (nxt != cur)
+		nxt->sts.count++;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif
+
 void *core_tsk_handler( void *sp )
 {
 	tsk_t *cur, *nxt;
@@ -567,13 +1323,16 @@ void *core_tsk_handler( void *sp )
 
 	port_set_lock();
 	{
+#if OS_DEFER_SIZE
+		core_srv_handler();
+#endif
 		core_ctx_reset();
 
 		cur = System.cur;
 		if (cur->sp == 0)
 			cur->sp = sp;
 
-		nxt = IDLE.hdr.next;
+		nxt = priv_tsk_head();
 
 #if OS_ROBIN && HW_TIMER_SIZE == 0
 		if (cur == nxt || (nxt->slice >= (OS_FREQUENCY)/(OS_ROBIN) && (nxt->slice = 0) == 0))
@@ -581,11 +1340,17 @@ void *core_tsk_handler( void *sp )
 		if (cur == nxt)
 #endif
 		{
-			priv_tsk_remove(nxt);
-			priv_tsk_insert(nxt);
-			nxt = IDLE.hdr.next;
+			priv_tsk_rotate(nxt);
+			nxt = priv_tsk_head();
 		}
 
+#if OS_TASK_STATS
+		priv_tsk_stats(cur, nxt);
+#endif
+#if OS_TRACE_SIZE
+		if (nxt != cur)
+			core_trc_put(trcSwitch, cur, (uintptr_t)nxt);
+#endif
 		System.cur = nxt;
 		sp = nxt->sp;
 		nxt->sp = 0;
@@ -702,9 +1467,51 @@ void core_sys_tick( void )
 
 /* -------------------------------------------------------------------------- */
 
+cnt_t core_sys_suspend( void )
+{
+	cnt_t delay;
+
+	port_set_lock();
+	{
+#if HW_TIMER_SIZE == 0
+		port_sys_suspend();
+#endif
+		delay = priv_tmr_delay();
+	}
+	port_clr_lock();
+
+	return delay;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void core_sys_resume( cnt_t ticks )
+{
+	port_set_lock();
+	{
+#if HW_TIMER_SIZE == 0
+		System.cnt += ticks;
+		port_sys_resume();
+#else
+		(void) ticks;
+#endif
+	}
+	port_clr_lock();
+
+	core_tmr_handler();
+}
+
+/* -------------------------------------------------------------------------- */
+
 void core_tsk_idle( void )
 {
+#if HW_TIMER_SIZE == 0 && OS_TICK_SUPPRESS
+	__disable_irq(); // interrupts masked with PRIMASK still wake up the core
+	System.cnt += port_sys_sleep(priv_tmr_delay());
+	__enable_irq();
+#else
 	__WFI();
+#endif
 }
 
 /* -------------------------------------------------------------------------- */
@@ -713,7 +1520,7 @@ void core_res_free( obj_t *obj )
 {
 	if (obj->res != NULL && obj->res != RELEASED)
 	{
-		free(obj->res);
+		core_obj_free(obj->res);
 		obj->res = RELEASED;
 	}
 }
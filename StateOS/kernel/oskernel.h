@@ -54,6 +54,7 @@
 #endif
 
 #if    __cplusplus >= 201402
+#include <cstddef>
 #include <functional>
 #include <memory>
 
@@ -167,11 +168,126 @@ void core_tmr_insert( tmr_t *tmr );
 // remove task / timer 'tmr' from timers READY queue
 void core_tmr_remove( tmr_t *tmr );
 
+// return next task / timer after task / timer 'tmr' in timers READY queue
+// WAIT is both the beginning and the end of the queue: core_tmr_next(&WAIT) returns the first task / timer or WAIT
+tmr_t *core_tmr_next( tmr_t *tmr );
+
+// return number of ticks to the next event of the timers queue (INFINITE if there is no such event)
+cnt_t core_tmr_delay( void );
+
 // timers queue handler procedure
 void core_tmr_handler( void );
 
 /* -------------------------------------------------------------------------- */
 
+#if OS_DEFER_SIZE
+
+// deferred service procedure
+typedef int srv_t( void *obj, uintptr_t arg );
+
+// post request to call service 'srv' with parameters 'obj' and 'arg' to the deferred services queue
+// the request is executed by the context switch handler (PendSV) in the critical section
+// return E_SUCCESS if the request was posted, E_TIMEOUT if the queue is full and the request was dropped
+// every dropped request is counted (see sys_deferOverflow)
+// the service is never called directly, so the cost is bounded and kernel queues are never touched
+int core_srv_defer( srv_t *srv, void *obj, uintptr_t arg );
+
+// deferred services queue handler procedure
+void core_srv_handler( void );
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+// kernel trace event codes
+enum __trc_code
+{
+	trcNone = 0,
+	trcSwitch,   // context switch;         obj: current task, arg: next task
+	trcWait,     // task blocked;           obj: task,         arg: blocked queue (guard object)
+	trcWakeup,   // task resumed;           obj: task,         arg: event value
+	trcTimer,    // timer expired;          obj: timer,        arg: period
+	trcSemTake,  // semaphore take;         obj: semaphore,    arg: counter value
+	trcSemGive,  // semaphore give;         obj: semaphore,    arg: counter value
+	trcMtxTake,  // mutex take;             obj: mutex,        arg: owner
+	trcMtxGive,  // mutex give;             obj: mutex,        arg: owner
+	trcMutTake,  // fast mutex take;        obj: fast mutex,   arg: owner
+	trcMutGive,  // fast mutex give;        obj: fast mutex,   arg: owner
+	trcFlgTake,  // flag take;              obj: flag,         arg: flags
+	trcSigTake,  // signal take;            obj: signal,       arg: sigset
+	trcBarTake,  // barrier take;           obj: barrier,      arg: limit value
+	trcLstTake,  // list take;              obj: list,         arg: 0
+	trcBoxTake,  // mailbox queue take;     obj: mailbox,      arg: count of mails
+	trcBoxGive,  // mailbox queue give;     obj: mailbox,      arg: count of mails
+	trcMsgTake,  // message buffer take;    obj: message,      arg: size of buffer
+	trcMsgGive,  // message buffer give;    obj: message,      arg: size of message
+	trcStmTake,  // stream buffer take;     obj: stream,       arg: size of buffer
+	trcStmGive,  // stream buffer give;     obj: stream,       arg: size of data
+	trcEvqTake,  // event queue take;       obj: event queue,  arg: count of events
+	trcEvqGive,  // event queue give;       obj: event queue,  arg: event value
+	trcJobTake,  // job queue take;         obj: job queue,    arg: count of jobs
+	trcJobGive,  // job queue give;         obj: job queue,    arg: job procedure
+	trcPrqTake,  // priority queue take;    obj: priority queue, arg: count of mails
+	trcPrqGive,  // priority queue give;    obj: priority queue, arg: priority of mail
+};
+
+#if OS_TRACE_SIZE
+
+// put record with event code 'code', object 'obj' and argument 'arg' to the kernel trace buffer
+// must be called in the critical section
+void core_trc_put( unsigned code, const void *obj, uintptr_t arg );
+
+#else
+
+#define core_trc_put( code, obj, arg ) ((void)0)
+
+#endif
+
+#if OS_OBJ_SET
+
+// wake up a task waiting on the object set the object 'obj' belongs to
+// must be called in the critical section
+void core_set_wakeup( obj_t *obj );
+
+// notify the object set that the object 'obj' has become ready
+// must be called in the critical section
+__STATIC_INLINE
+void core_set_notify( obj_t *obj )
+{
+	if (obj->set != NULL)
+		core_set_wakeup(obj);
+}
+
+// check if the object 'obj' belongs to an object set
+__STATIC_INLINE
+bool core_set_member( obj_t *obj )
+{
+	return obj->set != NULL;
+}
+
+// remove the object 'obj' from the object set it belongs to
+// must be called in the critical section
+void core_set_unlink( obj_t *obj );
+
+// remove the object 'obj' from the object set if it belongs to any (the object is reset or destroyed)
+// must be called in the critical section
+__STATIC_INLINE
+void core_set_remove( obj_t *obj )
+{
+	if (obj->set != NULL)
+		core_set_unlink(obj);
+}
+
+#else
+
+#define core_set_notify( obj ) ((void)0)
+#define core_set_member( obj ) (false)
+#define core_set_remove( obj ) ((void)0)
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+
 // reset stack and restart the current task
 __NO_RETURN
 void core_tsk_flip( void *sp );
@@ -183,6 +299,10 @@ void core_tsk_insert( tsk_t *tsk );
 // remove task 'tsk' from tasks READY queue
 void core_tsk_remove( tsk_t *tsk );
 
+// return next task after task 'tsk' in tasks READY queue (in order of execution)
+// IDLE is both the beginning and the end of the queue: core_tsk_next(&IDLE) returns the first READY task or IDLE
+tsk_t *core_tsk_next( tsk_t *tsk );
+
 // append task 'tsk' to the blocked queue 'que'
 void core_tsk_append( tsk_t *tsk, tsk_t **obj );
 
@@ -192,6 +312,9 @@ void core_tsk_unlink( tsk_t *tsk, int event );
 // transfer task 'tsk' to the blocked queue 'que'
 void core_tsk_transfer( tsk_t *tsk, tsk_t **que );
 
+// restart the countdown of the blocked task 'tsk' from the current time
+void core_tsk_rewind( tsk_t *tsk );
+
 // delay execution of current task for given duration of time 'delay'
 // append the current task to the blocked queue 'que'
 // remove the current task from tasks READY queue
@@ -309,6 +432,54 @@ cnt_t core_sys_time( void )
 #endif
 }
 
+#if OS_TASK_STATS || OS_TRACE_SIZE
+// return current value of the tasks statistics / kernel trace counter
+__STATIC_INLINE
+uint32_t core_sts_time( void )
+{
+#if defined(DWT)
+	return DWT->CYCCNT;
+#else
+	return (uint32_t)core_sys_time();
+#endif
+}
+#endif
+
+#if OS_TASK_STATS
+// return number of cycles of the tasks statistics counter elapsed between the time stamps 'last' and 'now'
+// the cycle counter wraps every 2^32 cycles, so the system time of the time stamps is used to restore the wraps
+__STATIC_INLINE
+uint64_t core_sts_delta( uint32_t now, cnt_t tick, uint32_t last, cnt_t time )
+{
+	uint64_t delta = (uint32_t)(now - last);
+#if defined(DWT)
+	uint64_t cycles = (uint64_t)(cnt_t)(tick - time) * ((CPU_FREQUENCY)/(OS_FREQUENCY));
+
+	if (cycles > delta)
+		delta += (cycles - delta + 0x80000000U) & ~(uint64_t)0xFFFFFFFFU;
+#else
+	(void) tick;
+	(void) time;
+#endif
+	return delta;
+}
+#endif
+
+#if HW_TIMER_SIZE == 0 && OS_TICK_SUPPRESS
+// suppress interrupts of system timer for at most 'delay' ticks and sleep until any interrupt
+// must be called with interrupts disabled
+// return number of elapsed ticks not counted by the system timer interrupt handler
+cnt_t port_sys_sleep( cnt_t delay );
+#endif
+
+// stop the system timer (in non-tick-less mode)
+// return number of ticks to the next event of the timers queue (INFINITE if there is no such event)
+cnt_t core_sys_suspend( void );
+
+// advance the system counter by 'ticks' (in non-tick-less mode), restart the system timer
+// and handle expired timers
+void core_sys_resume( cnt_t ticks );
+
 // internal handler of system timer
 #if HW_TIMER_SIZE == 0
 void core_sys_tick( void );
@@ -327,6 +498,41 @@ void core_sys_tick( void )
 // default idle procedure
 void core_tsk_idle( void );
 
+// types of objects held in the object caches
+enum
+{
+	cacheBAR = 0, // barrier
+	cacheCND,     // condition variable
+	cacheEVT,     // event
+	cacheFLG,     // flag
+	cacheLST,     // list
+	cacheMTX,     // mutex
+	cacheMUT,     // fast mutex
+	cacheRWL,     // read/write lock
+	cacheSEM,     // semaphore
+	cacheSIG,     // signal
+	cacheTMR,     // timer
+	cacheTSK,     // task with the stack of size not greater than OS_STACK_SIZE
+	cacheTypes
+};
+
+// allocate memory for an object of given type and size
+// take it from the cache of given type if possible, otherwise from the heap memory
+#if OS_OBJ_CACHE
+void *core_obj_alloc( unsigned type, size_t size );
+#else
+__STATIC_INLINE
+void *core_obj_alloc( unsigned type, size_t size ) { (void) type; return malloc(size); }
+#endif
+
+// release memory of an object allocated with core_obj_alloc
+#if OS_OBJ_CACHE
+void core_obj_free( void *ptr );
+#else
+__STATIC_INLINE
+void core_obj_free( void *ptr ) { free(ptr); }
+#endif
+
 // frees resources of given object
 void core_res_free( obj_t *obj );
 
@@ -70,7 +70,7 @@ bar_t *bar_create( unsigned limit )
 
 	sys_lock();
 	{
-		bar = malloc(sizeof(bar_t));
+		bar = core_obj_alloc(cacheBAR, sizeof(bar_t));
 		if (bar)
 			priv_bar_init(bar, limit, bar);
 	}
@@ -123,6 +123,8 @@ static
 int priv_bar_take( bar_t *bar )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcBarTake, bar, bar->limit);
+
 	if (core_tsk_count(bar->obj.queue) + 1 == bar->limit)
 	{
 		core_all_wakeup(bar->obj.queue, E_SUCCESS);
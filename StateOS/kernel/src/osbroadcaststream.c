@@ -0,0 +1,726 @@
+/******************************************************************************
+
+    @file    StateOS: osbroadcaststream.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/osbroadcaststream.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_bst_init( bst_t *bst, void *data, size_t bufsize, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(bst, 0, sizeof(bst_t));
+
+	core_obj_init(&bst->obj, res);
+
+	bst->limit = bufsize;
+	bst->data  = data;
+}
+
+/* -------------------------------------------------------------------------- */
+void bst_init( bst_t *bst, void *data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(bst);
+	assert(data);
+	assert(bufsize);
+
+	sys_lock();
+	{
+		priv_bst_init(bst, data, bufsize, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+bst_t *bst_create( size_t limit )
+/* -------------------------------------------------------------------------- */
+{
+	struct bst_T { bst_t bst; char buf[]; } *tmp;
+	bst_t *bst = NULL;
+	size_t bufsize;
+
+	assert_tsk_context();
+	assert(limit);
+
+	sys_lock();
+	{
+		bufsize = limit;
+		tmp = malloc(sizeof(struct bst_T) + bufsize);
+		if (tmp)
+			priv_bst_init(bst = &tmp->bst, tmp->buf, bufsize, tmp);
+	}
+	sys_unlock();
+
+	return bst;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_bst_space( bst_t *bst )
+/* -------------------------------------------------------------------------- */
+{
+	size_t count = 0;
+	rdr_t *rdr;
+
+//	only the slowest of the blocking readers limits the producer
+	for (rdr = bst->rdrs; rdr != NULL; rdr = rdr->next)
+		if (rdr->mode == rdrBlock && rdr->count > count)
+			count = rdr->count;
+
+	return bst->limit - count;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rdr_get( rdr_t *rdr, char *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	bst_t *bst = rdr->bst;
+	size_t i = rdr->head;
+	size_t n = bst->limit - i;
+
+	if (n > size) n = size;
+	memcpy(data, &bst->data[i], n);
+	memcpy(data + n, bst->data, size - n);
+
+	rdr->count -= size;
+	i += size;
+	if (i >= bst->limit) i -= bst->limit;
+	rdr->head = i;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rdr_skip( rdr_t *rdr, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	rdr->count -= size;
+	rdr->head  += size;
+	if (rdr->head >= rdr->bst->limit) rdr->head -= rdr->bst->limit;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rdr_putWakeup( rdr_t *rdr )
+/* -------------------------------------------------------------------------- */
+{
+	size_t size;
+
+	while (rdr->obj.queue != 0 && rdr->count > 0)
+	{
+		size = rdr->obj.queue->tmp.stm.size;
+		if (size > rdr->count) size = rdr->count;
+		rdr->obj.queue->tmp.stm.size = size;
+		priv_rdr_get(rdr, rdr->obj.queue->tmp.stm.data.in, size);
+		core_one_wakeup(rdr->obj.queue, E_SUCCESS);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_bst_put( bst_t *bst, const char *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	size_t i = bst->tail;
+	size_t n = bst->limit - i;
+	rdr_t *rdr;
+
+	if (n > size) n = size;
+	memcpy(&bst->data[i], data, n);
+	memcpy(bst->data, data + n, size - n);
+
+	i += size;
+	if (i >= bst->limit) i -= bst->limit;
+	bst->tail = i;
+
+	for (rdr = bst->rdrs; rdr != NULL; rdr = rdr->next)
+	{
+		rdr->count += size;
+		if (rdr->count > bst->limit)
+		{
+		//	overrun of the dropping reader, its oldest data has just been overwritten
+			rdr->lost += rdr->count - bst->limit;
+			priv_rdr_skip(rdr, rdr->count - bst->limit);
+		}
+		priv_rdr_putWakeup(rdr);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_bst_getWakeup( bst_t *bst )
+/* -------------------------------------------------------------------------- */
+{
+	while (bst->obj.queue != 0 && bst->obj.queue->tmp.stm.size <= priv_bst_space(bst))
+	{
+		priv_bst_put(bst, bst->obj.queue->tmp.stm.data.out, bst->obj.queue->tmp.stm.size);
+		core_one_wakeup(bst->obj.queue, E_SUCCESS);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rdr_getWakeup( rdr_t *rdr )
+/* -------------------------------------------------------------------------- */
+{
+	if (rdr->mode == rdrBlock)
+		priv_bst_getWakeup(rdr->bst);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rdr_unlink( rdr_t *rdr, int event )
+/* -------------------------------------------------------------------------- */
+{
+	bst_t *bst = rdr->bst;
+	rdr_t **ptr = &bst->rdrs;
+
+	while (*ptr != rdr)
+		ptr = &(*ptr)->next;
+	*ptr = rdr->next;
+
+	rdr->next  = NULL;
+	rdr->bst   = NULL;
+	rdr->count = 0;
+	rdr->head  = 0;
+
+//	producers blocked on this reader can continue
+	priv_bst_getWakeup(bst);
+//	tasks waiting for data of the reader would never get any
+	core_all_wakeup(rdr->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_bst_reset( bst_t *bst, int event )
+/* -------------------------------------------------------------------------- */
+{
+	rdr_t *rdr;
+
+	for (rdr = bst->rdrs; rdr != NULL; rdr = rdr->next)
+	{
+		rdr->count = 0;
+		rdr->head  = bst->tail;
+	}
+
+	core_all_wakeup(bst->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void bst_reset( bst_t *bst )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(bst);
+	assert(bst->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_bst_reset(bst, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void bst_destroy( bst_t *bst )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(bst);
+	assert(bst->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_bst_reset(bst, bst->obj.res ? E_DELETED : E_STOPPED);
+		while (bst->rdrs != NULL)
+			priv_rdr_unlink(bst->rdrs, bst->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&bst->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_bst_give( bst_t *bst, const char *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	if (size <= priv_bst_space(bst))
+	{
+		priv_bst_put(bst, data, size);
+		return E_SUCCESS;
+	}
+
+	if (size <= bst->limit)
+		return E_TIMEOUT;
+
+	return E_FAILURE;
+}
+
+/* -------------------------------------------------------------------------- */
+int bst_give( bst_t *bst, const void *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(bst);
+	assert(bst->obj.res!=RELEASED);
+	assert(bst->data);
+	assert(bst->limit);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_bst_give(bst, data, size);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int bst_sendFor( bst_t *bst, const void *data, size_t size, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(bst);
+	assert(bst->obj.res!=RELEASED);
+	assert(bst->data);
+	assert(bst->limit);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_bst_give(bst, data, size);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.stm.data.out = data;
+			System.cur->tmp.stm.size = size;
+			result = core_tsk_waitFor(&bst->obj.queue, delay);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int bst_sendUntil( bst_t *bst, const void *data, size_t size, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(bst);
+	assert(bst->obj.res!=RELEASED);
+	assert(bst->data);
+	assert(bst->limit);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_bst_give(bst, data, size);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.stm.data.out = data;
+			System.cur->tmp.stm.size = size;
+			result = core_tsk_waitUntil(&bst->obj.queue, time);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+size_t bst_space( bst_t *bst )
+/* -------------------------------------------------------------------------- */
+{
+	size_t space;
+
+	assert(bst);
+	assert(bst->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		space = priv_bst_space(bst);
+	}
+	sys_unlock();
+
+	return space;
+}
+
+/* -------------------------------------------------------------------------- */
+size_t bst_limit( bst_t *bst )
+/* -------------------------------------------------------------------------- */
+{
+	size_t limit;
+
+	assert(bst);
+	assert(bst->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		limit = bst->limit;
+	}
+	sys_unlock();
+
+	return limit;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rdr_init( rdr_t *rdr, unsigned mode, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(rdr, 0, sizeof(rdr_t));
+
+	core_obj_init(&rdr->obj, res);
+
+	rdr->mode = mode;
+}
+
+/* -------------------------------------------------------------------------- */
+void rdr_init( rdr_t *rdr, unsigned mode )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rdr);
+	assert(mode<=rdrBlock);
+
+	sys_lock();
+	{
+		priv_rdr_init(rdr, mode, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+rdr_t *rdr_create( unsigned mode )
+/* -------------------------------------------------------------------------- */
+{
+	rdr_t *rdr;
+
+	assert_tsk_context();
+	assert(mode<=rdrBlock);
+
+	sys_lock();
+	{
+		rdr = malloc(sizeof(rdr_t));
+		if (rdr)
+			priv_rdr_init(rdr, mode, rdr);
+	}
+	sys_unlock();
+
+	return rdr;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rdr_reset( rdr_t *rdr, int event )
+/* -------------------------------------------------------------------------- */
+{
+	if (rdr->bst != NULL)
+	{
+		priv_rdr_skip(rdr, rdr->count);
+		priv_rdr_getWakeup(rdr);
+	}
+
+	rdr->lost = 0;
+
+	core_all_wakeup(rdr->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void rdr_reset( rdr_t *rdr )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_rdr_reset(rdr, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void rdr_destroy( rdr_t *rdr )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (rdr->bst != NULL)
+			priv_rdr_unlink(rdr, rdr->obj.res ? E_DELETED : E_STOPPED);
+		priv_rdr_reset(rdr, rdr->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&rdr->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+int rdr_attach( rdr_t *rdr, bst_t *bst )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_FAILURE;
+
+	assert_tsk_context();
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+	assert(bst);
+	assert(bst->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (rdr->bst == NULL)
+		{
+			rdr->bst   = bst;
+			rdr->count = 0;
+			rdr->head  = bst->tail;
+			rdr->next  = bst->rdrs;
+			bst->rdrs  = rdr;
+			result = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+void rdr_detach( rdr_t *rdr )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (rdr->bst != NULL)
+			priv_rdr_unlink(rdr, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_rdr_take( rdr_t *rdr, char *data, size_t size, size_t *read )
+/* -------------------------------------------------------------------------- */
+{
+	if (rdr->count > 0)
+	{
+		if (size > rdr->count) size = rdr->count;
+		priv_rdr_get(rdr, data, size);
+		priv_rdr_getWakeup(rdr);
+		if (read != NULL)
+			*read = size;
+		return E_SUCCESS;
+	}
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+int rdr_take( rdr_t *rdr, void *data, size_t size, size_t *read )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_rdr_take(rdr, data, size, read);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int rdr_waitFor( rdr_t *rdr, void *data, size_t size, size_t *read, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_rdr_take(rdr, data, size, read);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.stm.data.in = data;
+			System.cur->tmp.stm.size = size;
+			result = core_tsk_waitFor(&rdr->obj.queue, delay);
+			if (result == E_SUCCESS && read != NULL)
+				*read = System.cur->tmp.stm.size;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int rdr_waitUntil( rdr_t *rdr, void *data, size_t size, size_t *read, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+	assert(data);
+	assert(size);
+
+	sys_lock();
+	{
+		result = priv_rdr_take(rdr, data, size, read);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.stm.data.in = data;
+			System.cur->tmp.stm.size = size;
+			result = core_tsk_waitUntil(&rdr->obj.queue, time);
+			if (result == E_SUCCESS && read != NULL)
+				*read = System.cur->tmp.stm.size;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+const void *rdr_peek( rdr_t *rdr, size_t *size )
+/* -------------------------------------------------------------------------- */
+{
+	const void *data = NULL;
+	size_t count;
+
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+	assert(size);
+
+	sys_lock();
+	{
+		count = rdr->count;
+		if (count > 0)
+		{
+			if (count > rdr->bst->limit - rdr->head)
+				count = rdr->bst->limit - rdr->head;
+			data = &rdr->bst->data[rdr->head];
+		}
+	}
+	sys_unlock();
+
+	*size = count;
+	return data;
+}
+
+/* -------------------------------------------------------------------------- */
+void rdr_consume( rdr_t *rdr, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (rdr->bst != NULL)
+		{
+		//	the dropping reader could have lost the region after an overrun
+			if (size > rdr->count) size = rdr->count;
+			priv_rdr_skip(rdr, size);
+			priv_rdr_getWakeup(rdr);
+		}
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+size_t rdr_count( rdr_t *rdr )
+/* -------------------------------------------------------------------------- */
+{
+	size_t count;
+
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		count = rdr->count;
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+size_t rdr_lost( rdr_t *rdr )
+/* -------------------------------------------------------------------------- */
+{
+	size_t lost;
+
+	assert(rdr);
+	assert(rdr->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		lost = rdr->lost;
+	}
+	sys_unlock();
+
+	return lost;
+}
+
+/* -------------------------------------------------------------------------- */
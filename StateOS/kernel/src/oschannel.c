@@ -0,0 +1,472 @@
+/******************************************************************************
+
+    @file    StateOS: oschannel.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "inc/oschannel.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_chn_init( chn_t *chn, size_t size, void *data, size_t bufsize, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(chn, 0, sizeof(chn_t));
+
+	core_obj_init(&chn->obj, res);
+
+	chn->limit = bufsize / size;
+	chn->size  = size;
+	chn->data  = data;
+}
+
+/* -------------------------------------------------------------------------- */
+void chn_init( chn_t *chn, size_t size, void *data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(chn);
+	assert(size);
+	assert(data);
+	assert(bufsize);
+
+	sys_lock();
+	{
+		priv_chn_init(chn, size, data, bufsize, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+chn_t *chn_create( unsigned limit, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	struct chn_T { chn_t chn; char buf[]; } *tmp;
+	chn_t *chn = NULL;
+	size_t bufsize;
+
+	assert_tsk_context();
+	assert(limit);
+	assert(size);
+
+	sys_lock();
+	{
+		bufsize = limit * size;
+		tmp = malloc(sizeof(struct chn_T) + bufsize);
+		if (tmp)
+			priv_chn_init(chn = &tmp->chn, size, tmp->buf, bufsize, tmp);
+	}
+	sys_unlock();
+
+	return chn;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void *priv_chn_slot( chn_t *chn, unsigned i )
+/* -------------------------------------------------------------------------- */
+{
+	return &chn->data[i * chn->size];
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_chn_reset( chn_t *chn, int event )
+/* -------------------------------------------------------------------------- */
+{
+	if (chn->drop != NULL)
+	{
+		while (chn->count > 0)
+		{
+			chn->drop(priv_chn_slot(chn, chn->head));
+			chn->head = (chn->head + 1 < chn->limit) ? chn->head + 1 : 0;
+			chn->count--;
+		}
+	}
+
+	chn->count = 0;
+	chn->head  = 0;
+	chn->tail  = 0;
+
+	core_all_wakeup(chn->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void chn_reset( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_chn_reset(chn, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void chn_destroy( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_chn_reset(chn, chn->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&chn->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_chn_assign( chn_t *chn, void *dst, void *src )
+/* -------------------------------------------------------------------------- */
+{
+	if (chn->move != NULL)
+		chn->move(dst, src);
+	else
+		memcpy(dst, src, chn->size);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_chn_get( chn_t *chn, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	void *slot = priv_chn_slot(chn, chn->head);
+
+	priv_chn_assign(chn, data, slot);
+	if (chn->drop != NULL)
+		chn->drop(slot);
+	chn->head = (chn->head + 1 < chn->limit) ? chn->head + 1 : 0;
+	chn->count--;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_chn_put( chn_t *chn, void (*fun)( void *, void * ), void *arg )
+/* -------------------------------------------------------------------------- */
+{
+	void *slot = priv_chn_slot(chn, chn->tail);
+
+	if (fun != NULL)
+		fun(slot, arg);
+	else
+	if (chn->init != NULL)
+		chn->init(slot, arg);
+	else
+		memcpy(slot, arg, chn->size);
+	chn->tail = (chn->tail + 1 < chn->limit) ? chn->tail + 1 : 0;
+	chn->count++;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_chn_take( chn_t *chn, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk;
+
+	if (chn->count == 0)
+		return E_TIMEOUT;
+
+	priv_chn_get(chn, data);
+	tsk = core_one_wakeup(chn->obj.queue, E_SUCCESS);
+	if (tsk) priv_chn_put(chn, tsk->tmp.chn.fun, tsk->tmp.chn.data);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_chn_give( chn_t *chn, void (*fun)( void *, void * ), void *arg )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk;
+
+	if (chn->count >= chn->limit)
+		return E_TIMEOUT;
+
+	tsk = core_one_wakeup(chn->obj.queue, E_SUCCESS);
+	if (tsk == NULL)
+		priv_chn_put(chn, fun, arg);
+	else
+	if (fun == NULL)
+	//	move the element directly to the waiting task
+		priv_chn_assign(chn, tsk->tmp.chn.data, arg);
+	else
+	{
+		priv_chn_put(chn, fun, arg);
+		priv_chn_get(chn, tsk->tmp.chn.data);
+	}
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_take( chn_t *chn, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->data);
+	assert(chn->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_chn_take(chn, data);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_waitFor( chn_t *chn, void *data, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->data);
+	assert(chn->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_chn_take(chn, data);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.chn.data = data;
+			result = core_tsk_waitFor(&chn->obj.queue, delay);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_waitUntil( chn_t *chn, void *data, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->data);
+	assert(chn->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_chn_take(chn, data);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.chn.data = data;
+			result = core_tsk_waitUntil(&chn->obj.queue, time);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_give( chn_t *chn, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->data);
+	assert(chn->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_chn_give(chn, NULL, data);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_sendFor( chn_t *chn, void *data, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	return chn_emplaceFor(chn, NULL, data, delay);
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_sendUntil( chn_t *chn, void *data, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	return chn_emplaceUntil(chn, NULL, data, time);
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_emplace( chn_t *chn, void (*fun)( void *, void * ), void *arg )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->data);
+	assert(chn->limit);
+	assert(fun);
+
+	sys_lock();
+	{
+		result = priv_chn_give(chn, fun, arg);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_emplaceFor( chn_t *chn, void (*fun)( void *, void * ), void *arg, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->data);
+	assert(chn->limit);
+	assert(fun || arg);
+
+	sys_lock();
+	{
+		result = priv_chn_give(chn, fun, arg);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.chn.data = arg;
+			System.cur->tmp.chn.fun  = fun;
+			result = core_tsk_waitFor(&chn->obj.queue, delay);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int chn_emplaceUntil( chn_t *chn, void (*fun)( void *, void * ), void *arg, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+	assert(chn->data);
+	assert(chn->limit);
+	assert(fun || arg);
+
+	sys_lock();
+	{
+		result = priv_chn_give(chn, fun, arg);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.chn.data = arg;
+			System.cur->tmp.chn.fun  = fun;
+			result = core_tsk_waitUntil(&chn->obj.queue, time);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned chn_count( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		count = chn->count;
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned chn_space( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned space;
+
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		space = chn->limit - chn->count;
+	}
+	sys_unlock();
+
+	return space;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned chn_limit( chn_t *chn )
+/* -------------------------------------------------------------------------- */
+{
+	assert(chn);
+	assert(chn->obj.res!=RELEASED);
+
+	return chn->limit;
+}
+
+/* -------------------------------------------------------------------------- */
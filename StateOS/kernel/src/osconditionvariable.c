@@ -30,6 +30,7 @@
  ******************************************************************************/
 
 #include "inc/osconditionvariable.h"
+#include "inc/ostask.h"
 #include "inc/oscriticalsection.h"
 
 /* -------------------------------------------------------------------------- */
@@ -66,7 +67,7 @@ cnd_t *cnd_create( void )
 
 	sys_lock();
 	{
-		cnd = malloc(sizeof(cnd_t));
+		cnd = core_obj_alloc(cacheCND, sizeof(cnd_t));
 		if (cnd)
 			priv_cnd_init(cnd, cnd);
 	}
@@ -114,12 +115,44 @@ void cnd_destroy( cnd_t *cnd )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+static
+int priv_cnd_lock( mtx_t *mtx, int event )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+	tsk_t *cur = System.cur;
+
+	if (cur->tmp.cnd.mtx == NULL)
+	{
+	//	the task has been moved to the mutex by cnd_give
+		cur->mtx.tree = NULL;
+
+		if (event == E_SUCCESS && (mtx->mode & mtxInconsistent))
+		{
+			mtx->mode &= ~mtxInconsistent;
+			return OWNERDEAD;
+		}
+
+		if (event != E_TIMEOUT)
+			return event;
+
+	//	the timeout expired while waiting for the mutex
+		event = E_SUCCESS;
+	}
+
+	result = mtx_wait(mtx);
+	if (result == E_SUCCESS)
+		result = event;
+
+	return result;
+}
+
 /* -------------------------------------------------------------------------- */
 int cnd_waitFor( cnd_t *cnd, mtx_t *mtx, cnt_t delay )
 /* -------------------------------------------------------------------------- */
 {
 	int result;
-	int wait_result;
 
 	assert_tsk_context();
 	assert(cnd);
@@ -132,10 +165,9 @@ int cnd_waitFor( cnd_t *cnd, mtx_t *mtx, cnt_t delay )
 		result = mtx_give(mtx);
 		if (result == E_SUCCESS)
 		{
-			wait_result = core_tsk_waitFor(&cnd->obj.queue, delay);
-			result = mtx_wait(mtx);
-			if (result == E_SUCCESS)
-				result = wait_result;
+			System.cur->tmp.cnd.mtx = mtx;
+			result = core_tsk_waitFor(&cnd->obj.queue, delay);
+			result = priv_cnd_lock(mtx, result);
 		}
 	}
 	sys_unlock();
@@ -148,7 +180,6 @@ int cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 /* -------------------------------------------------------------------------- */
 {
 	int result;
-	int wait_result;
 
 	assert_tsk_context();
 	assert(cnd);
@@ -161,10 +192,9 @@ int cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 		result = mtx_give(mtx);
 		if (result == E_SUCCESS)
 		{
-			wait_result = core_tsk_waitUntil(&cnd->obj.queue, time);
-			result = mtx_wait(mtx);
-			if (result == E_SUCCESS)
-				result = wait_result;
+			System.cur->tmp.cnd.mtx = mtx;
+			result = core_tsk_waitUntil(&cnd->obj.queue, time);
+			result = priv_cnd_lock(mtx, result);
 		}
 	}
 	sys_unlock();
@@ -172,6 +202,37 @@ int cnd_waitUntil( cnd_t *cnd, mtx_t *mtx, cnt_t time )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+void priv_cnd_wakeup( tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	mtx_t *mtx = tsk->tmp.cnd.mtx;
+
+	if (mtx->owner == tsk || ((mtx->mode & mtxPrioMASK) == mtxPrioProtect && mtx->prio < tsk->prio))
+	{
+	//	the task has to lock the mutex by itself
+		core_tsk_wakeup(tsk, E_SUCCESS);
+		return;
+	}
+
+	tsk->tmp.cnd.mtx = NULL;
+
+	if (mtx->owner == NULL)
+	{
+	//	hand the free mutex over to the task
+		core_mtx_link(mtx, tsk);
+		core_tsk_wakeup(tsk, E_SUCCESS);
+		return;
+	}
+
+//	move the task to the queue of the locked mutex without waking it up (wait morphing)
+	core_tsk_transfer(tsk, &mtx->obj.queue);
+	tsk->mtx.tree = mtx;
+	if ((mtx->mode & mtxPrioMASK) != mtxPrioNone && mtx->owner->prio < tsk->prio)
+		core_tsk_prio(mtx->owner, tsk->prio);
+}
+
 /* -------------------------------------------------------------------------- */
 void cnd_give( cnd_t *cnd, bool all )
 /* -------------------------------------------------------------------------- */
@@ -181,9 +242,41 @@ void cnd_give( cnd_t *cnd, bool all )
 
 	sys_lock();
 	{
-		while (core_one_wakeup(cnd->obj.queue, E_SUCCESS) && all);
+		while (cnd->obj.queue)
+		{
+			priv_cnd_wakeup(cnd->obj.queue);
+			if (!all) break;
+		}
 	}
 	sys_unlock();
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_cnd_giveDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	cnd_give(obj, (bool) arg);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+void cnd_giveISR( cnd_t *cnd, bool all )
+/* -------------------------------------------------------------------------- */
+{
+	assert(cnd);
+	assert(cnd->obj.res!=RELEASED);
+
+	core_srv_defer(priv_cnd_giveDeferred, cnd, all);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
@@ -67,7 +67,7 @@ evt_t *evt_create( void )
 
 	sys_lock();
 	{
-		evt = malloc(sizeof(evt_t));
+		evt = core_obj_alloc(cacheEVT, sizeof(evt_t));
 		if (evt)
 			priv_evt_init(evt, evt);
 	}
@@ -178,3 +178,31 @@ void evt_give( evt_t *evt, unsigned event )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_evt_giveDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	evt_give(obj, (unsigned) arg);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+void evt_giveISR( evt_t *evt, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	assert(evt);
+	assert(evt->obj.res!=RELEASED);
+
+	core_srv_defer(priv_evt_giveDeferred, evt, event);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
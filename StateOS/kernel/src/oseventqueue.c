@@ -94,6 +94,8 @@ void priv_evq_reset( evq_t *evq, int event )
 	evq->head  = 0;
 	evq->tail  = 0;
 
+	core_set_remove(&evq->obj);
+
 	core_all_wakeup(evq->obj.queue, event);
 }
 
@@ -193,6 +195,7 @@ void priv_evq_putUpdate( evq_t *evq, const unsigned event )
 
 	tsk = core_one_wakeup(evq->obj.queue, E_SUCCESS);
 	if (tsk) tsk->tmp.evq.event = priv_evq_get(evq);
+	else     core_set_notify(&evq->obj);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -217,6 +220,8 @@ int priv_evq_take( evq_t *evq, unsigned *event )
 {
 	unsigned tmp;
 
+	core_trc_put(trcEvqTake, evq, evq->count);
+
 	if (evq->count > 0)
 	{
 		tmp = priv_evq_getUpdate(evq);
@@ -307,6 +312,8 @@ static
 int priv_evq_give( evq_t *evq, unsigned event )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcEvqGive, evq, event);
+
 	if (evq->count < evq->limit)
 	{
 		priv_evq_putUpdate(evq, event);
@@ -336,6 +343,34 @@ int evq_give( evq_t *evq, unsigned event )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_evq_giveDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	return evq_give(obj, (unsigned) arg);
+}
+
+/* -------------------------------------------------------------------------- */
+int evq_giveISR( evq_t *evq, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	assert(evq);
+	assert(evq->obj.res!=RELEASED);
+	assert(evq->data);
+	assert(evq->limit);
+
+	return core_srv_defer(priv_evq_giveDeferred, evq, event);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
 /* -------------------------------------------------------------------------- */
 int evq_sendFor( evq_t *evq, unsigned event, cnt_t delay )
 /* -------------------------------------------------------------------------- */
@@ -405,6 +440,84 @@ void evq_push( evq_t *evq, unsigned event )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_evq_pushDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	evq_push(obj, (unsigned) arg);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+void evq_pushISR( evq_t *evq, unsigned event )
+/* -------------------------------------------------------------------------- */
+{
+	assert(evq);
+	assert(evq->obj.res!=RELEASED);
+	assert(evq->data);
+	assert(evq->limit);
+
+	core_srv_defer(priv_evq_pushDeferred, evq, event);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+unsigned evq_giveMany( evq_t *evq, const unsigned *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned num = 0;
+
+	assert(evq);
+	assert(evq->obj.res!=RELEASED);
+	assert(evq->data);
+	assert(evq->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		core_trc_put(trcEvqGive, evq, count ? data[0] : 0);
+
+		for (; num < count && evq->count < evq->limit; num++)
+			priv_evq_putUpdate(evq, data[num]);
+	}
+	sys_unlock();
+
+	return num;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned evq_takeMany( evq_t *evq, unsigned *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned num = 0;
+
+	assert(evq);
+	assert(evq->obj.res!=RELEASED);
+	assert(evq->data);
+	assert(evq->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		core_trc_put(trcEvqTake, evq, evq->count);
+
+		for (; num < count && evq->count > 0; num++)
+			data[num] = priv_evq_getUpdate(evq);
+	}
+	sys_unlock();
+
+	return num;
+}
+
 /* -------------------------------------------------------------------------- */
 unsigned evq_count( evq_t *evq )
 /* -------------------------------------------------------------------------- */
@@ -0,0 +1,446 @@
+/******************************************************************************
+
+    @file    StateOS: osexecutor.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/osexecutor.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+void exj_init( exj_t *job, void (*fun)( void * ), void *arg, void (*done)( exj_t * ) )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(job);
+
+	sys_lock();
+	{
+		memset(job, 0, sizeof(exj_t));
+
+		core_obj_init(&job->obj, NULL);
+
+		job->fun  = fun;
+		job->arg  = arg;
+		job->done = done;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+int exj_take( exj_t *job )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(job);
+
+	sys_lock();
+	{
+		result = job->exe == NULL ? E_SUCCESS : E_TIMEOUT;
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int exj_waitFor( exj_t *job, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_SUCCESS;
+
+	assert_tsk_context();
+	assert(job);
+
+	sys_lock();
+	{
+		if (job->exe != NULL)
+			result = core_tsk_waitFor(&job->obj.queue, delay);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int exj_waitUntil( exj_t *job, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_SUCCESS;
+
+	assert_tsk_context();
+	assert(job);
+
+	sys_lock();
+	{
+		if (job->exe != NULL)
+			result = core_tsk_waitUntil(&job->obj.queue, time);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_exj_finish( exj_t *job, unsigned state, int event )
+/* -------------------------------------------------------------------------- */
+{
+	job->exe   = NULL;
+	job->state = state;
+
+	core_all_wakeup(job->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_exe_init( exe_t *exe, unsigned prio, tsk_t *workers, unsigned limit, stk_t *stack, size_t size, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(exe, 0, sizeof(exe_t));
+
+	core_obj_init(&exe->obj, res);
+
+	exe->prio    = prio;
+	exe->limit   = limit;
+	exe->workers = workers;
+	exe->stack   = stack;
+	exe->size    = size;
+}
+
+/* -------------------------------------------------------------------------- */
+void exe_init( exe_t *exe, unsigned prio, tsk_t *workers, unsigned limit, stk_t *stack, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(exe);
+	assert(workers);
+	assert(limit);
+	assert(stack);
+	assert(size>sizeof(ctx_t));
+
+	sys_lock();
+	{
+		priv_exe_init(exe, prio, workers, limit, stack, STK_OVER(size), NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+exe_t *exe_create( unsigned limit, unsigned prio, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	struct exe_T { exe_t exe; tsk_t wrk[]; } *tmp;
+	exe_t *exe = NULL;
+	size_t offset;
+
+	assert_tsk_context();
+	assert(limit);
+	assert(size>sizeof(ctx_t));
+
+	sys_lock();
+	{
+		offset = ALIGNED(sizeof(struct exe_T) + limit * sizeof(tsk_t), sizeof(stk_t));
+		tmp = malloc(offset + limit * STK_OVER(size));
+		if (tmp)
+			priv_exe_init(exe = &tmp->exe, prio, tmp->wrk, limit, (stk_t *)((char *)tmp + offset), STK_OVER(size), tmp);
+	}
+	sys_unlock();
+
+	if (exe)
+		exe_start(exe);
+
+	return exe;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+exj_t *priv_exe_get( exe_t *exe )
+/* -------------------------------------------------------------------------- */
+{
+	exj_t *job = exe->head;
+
+	if (job != NULL)
+	{
+		exe->head = job->next;
+		exe->count--;
+		job->next = exe->busy;
+		exe->busy = job;
+		job->state = exjRunning;
+	}
+
+	return job;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_exe_put( exe_t *exe, exj_t *job )
+/* -------------------------------------------------------------------------- */
+{
+	exj_t **ptr = &exe->head;
+
+	while (*ptr != NULL && (*ptr)->prio >= job->prio)
+		ptr = &(*ptr)->next;
+
+	job->next = *ptr;
+	*ptr = job;
+	exe->count++;
+	job->state = exjQueued;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_exe_unlink( exj_t **ptr, exj_t *job )
+/* -------------------------------------------------------------------------- */
+{
+	while (*ptr != NULL)
+	{
+		if (*ptr == job)
+		{
+			*ptr = job->next;
+			job->next = NULL;
+			return true;
+		}
+		ptr = &(*ptr)->next;
+	}
+
+	return false;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_exe_worker( void )
+/* -------------------------------------------------------------------------- */
+{
+	exe_t *exe = System.cur->tmp.exe.exe;
+	exj_t *job;
+
+	for (;;)
+	{
+		sys_lock();
+		{
+			job = priv_exe_get(exe);
+			if (job == NULL && core_tsk_waitFor(&exe->obj.queue, INFINITE) == E_SUCCESS)
+				job = System.cur->tmp.exe.job;
+		}
+		sys_unlock();
+
+		if (job == NULL)
+			continue;
+
+		if (job->fun != NULL)
+			job->fun(job->arg);
+
+		if (job->done != NULL)
+			job->done(job);
+
+		sys_lock();
+		{
+			priv_exe_unlink(&exe->busy, job);
+			priv_exj_finish(job, exjDone, E_SUCCESS);
+		}
+		sys_unlock();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+void exe_start( exe_t *exe )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk;
+	unsigned i;
+
+	assert_tsk_context();
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+	assert(exe->workers);
+	assert(exe->stack);
+
+	for (i = 0; i < exe->limit; i++)
+	{
+		tsk = &exe->workers[i];
+
+		sys_lock();
+		{
+			if (tsk->hdr.id == ID_STOPPED)  // active workers cannot be started
+			{
+				wrk_init(tsk, exe->prio, priv_exe_worker, exe->stack + i * (exe->size / sizeof(stk_t)), exe->size);
+				tsk->tmp.exe.exe = exe;
+				tsk_start(tsk);
+			}
+		}
+		sys_unlock();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_exe_reset( exe_t *exe, int event )
+/* -------------------------------------------------------------------------- */
+{
+	exj_t *job;
+	unsigned i;
+
+	for (i = 0; i < exe->limit; i++)
+	{
+		assert(&exe->workers[i] != System.cur);
+		tsk_reset(&exe->workers[i]);
+	}
+
+	sys_lock();
+	{
+		while (exe->head != NULL)
+		{
+			job = exe->head;
+			exe->head = job->next;
+			priv_exj_finish(job, exjIdle, event);
+		}
+
+		while (exe->busy != NULL)
+		{
+			job = exe->busy;
+			exe->busy = job->next;
+			priv_exj_finish(job, exjIdle, event);
+		}
+
+		exe->count = 0;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void exe_reset( exe_t *exe )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+
+	priv_exe_reset(exe, E_STOPPED);
+}
+
+/* -------------------------------------------------------------------------- */
+void exe_destroy( exe_t *exe )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+
+	priv_exe_reset(exe, exe->obj.res ? E_DELETED : E_STOPPED);
+
+	sys_lock();
+	{
+		core_res_free(&exe->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+int exe_give( exe_t *exe, exj_t *job, unsigned prio )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk;
+	int result = E_FAILURE;
+
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+	assert(job);
+
+	sys_lock();
+	{
+		if (job->exe == NULL)
+		{
+			job->exe  = exe;
+			job->prio = prio;
+
+			tsk = core_one_wakeup(exe->obj.queue, E_SUCCESS);
+			if (tsk != NULL)
+			{
+				job->next = exe->busy;
+				exe->busy = job;
+				job->state = exjRunning;
+				tsk->tmp.exe.job = job;
+			}
+			else
+			{
+				priv_exe_put(exe, job);
+			}
+
+			result = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int exe_cancel( exe_t *exe, exj_t *job )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_FAILURE;
+
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+	assert(job);
+
+	sys_lock();
+	{
+		if (job->exe == exe && job->state == exjQueued && priv_exe_unlink(&exe->head, job))
+		{
+			exe->count--;
+			priv_exj_finish(job, exjIdle, E_STOPPED);
+			result = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned exe_count( exe_t *exe )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(exe);
+	assert(exe->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		count = exe->count;
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -66,7 +66,7 @@ mut_t *mut_create( void )
 
 	sys_lock();
 	{
-		mut = malloc(sizeof(mut_t));
+		mut = core_obj_alloc(cacheMUT, sizeof(mut_t));
 		if (mut)
 			priv_mut_init(mut, mut);
 	}
@@ -114,11 +114,59 @@ void mut_destroy( mut_t *mut )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_FAST_PATH
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_mut_takeFast( mut_t *mut )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *owner = NULL;
+
+	if (atomic_compare_exchange_strong((tsk_t * _Atomic *)&mut->owner, &owner, System.cur))
+		return E_SUCCESS;
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_mut_giveFast( mut_t *mut )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *owner = System.cur;
+
+	if (!atomic_compare_exchange_strong((tsk_t * _Atomic *)&mut->owner, &owner, NULL))
+		return E_FAILURE;
+
+//	the mutex has already been released,
+//	now pass it to a task that could have started waiting in the meantime
+	if (mut->obj.queue != NULL)
+	{
+		sys_lock();
+		{
+			if (mut->owner == NULL)
+				mut->owner = core_one_wakeup(mut->obj.queue, E_SUCCESS);
+		}
+		sys_unlock();
+	}
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_FAST_PATH
+
 /* -------------------------------------------------------------------------- */
 static
 int priv_mut_take( mut_t *mut )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcMutTake, mut, (uintptr_t)mut->owner);
+
 	if (mut->owner == NULL)
 	{
 		mut->owner = System.cur;
@@ -141,6 +189,11 @@ int mut_take( mut_t *mut )
 	assert(mut);
 	assert(mut->obj.res!=RELEASED);
 
+#if OS_FAST_PATH
+	if (priv_mut_takeFast(mut) == E_SUCCESS)
+		return E_SUCCESS;
+#endif
+
 	sys_lock();
 	{
 		result = priv_mut_take(mut);
@@ -160,6 +213,11 @@ int mut_waitFor( mut_t *mut, cnt_t delay )
 	assert(mut);
 	assert(mut->obj.res!=RELEASED);
 
+#if OS_FAST_PATH
+	if (priv_mut_takeFast(mut) == E_SUCCESS)
+		return E_SUCCESS;
+#endif
+
 	sys_lock();
 	{
 		result = priv_mut_take(mut);
@@ -181,6 +239,11 @@ int mut_waitUntil( mut_t *mut, cnt_t time )
 	assert(mut);
 	assert(mut->obj.res!=RELEASED);
 
+#if OS_FAST_PATH
+	if (priv_mut_takeFast(mut) == E_SUCCESS)
+		return E_SUCCESS;
+#endif
+
 	sys_lock();
 	{
 		result = priv_mut_take(mut);
@@ -197,6 +260,8 @@ static
 int priv_mut_give( mut_t *mut )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcMutGive, mut, (uintptr_t)mut->owner);
+
 	if (mut->owner == System.cur)
 	{
 		mut->owner = core_one_wakeup(mut->obj.queue, E_SUCCESS);
@@ -216,6 +281,11 @@ int mut_give( mut_t *mut )
 	assert(mut);
 	assert(mut->obj.res!=RELEASED);
 
+#if OS_FAST_PATH
+	if (priv_mut_giveFast(mut) == E_SUCCESS)
+		return E_SUCCESS;
+#endif
+
 	sys_lock();
 	{
 		result = priv_mut_give(mut);
@@ -69,7 +69,7 @@ flg_t *flg_create( unsigned init )
 
 	sys_lock();
 	{
-		flg = malloc(sizeof(flg_t));
+		flg = core_obj_alloc(cacheFLG, sizeof(flg_t));
 		if (flg)
 			priv_flg_init(flg, init, flg);
 	}
@@ -85,6 +85,8 @@ void priv_flg_reset( flg_t *flg, int event )
 {
 	flg->flags = 0;
 
+	core_set_remove(&flg->obj);
+
 	core_all_wakeup(flg->obj.queue, event);
 }
 
@@ -126,6 +128,8 @@ unsigned priv_flg_take( flg_t *flg, unsigned flags, unsigned mode )
 {
 	unsigned result = flags;
 
+	core_trc_put(trcFlgTake, flg, flags);
+
 	if ((mode & flgIgnore) == 0)
 	{
 		result &= ~flg->flags;
@@ -209,46 +213,99 @@ int flg_waitUntil( flg_t *flg, unsigned flags, unsigned mode, cnt_t time )
 }
 
 /* -------------------------------------------------------------------------- */
-unsigned flg_give( flg_t *flg, unsigned flags )
+static
+unsigned priv_flg_give( flg_t *flg, unsigned flags )
 /* -------------------------------------------------------------------------- */
 {
-	unsigned result;
-
 	obj_t *obj;
 	tsk_t *tsk;
 
-	assert(flg);
-	assert(flg->obj.res!=RELEASED);
-
-	sys_lock();
+	obj = &flg->obj;
+	while (obj->queue)
 	{
-		flg->flags |= flags;
-
-		obj = &flg->obj;
-		while (obj->queue)
+		tsk = obj->queue;
+		if (tsk->tmp.flg.flags & flags)
 		{
-			tsk = obj->queue;
-			if (tsk->tmp.flg.flags & flags)
+			if ((tsk->tmp.flg.mode & flgProtect) == 0)
+				flg->flags &= ~(tsk->tmp.flg.flags & flags);
+			tsk->tmp.flg.flags &= ~flags;
+			if (tsk->tmp.flg.flags == 0 || (tsk->tmp.flg.mode & flgAll) == 0)
 			{
-				if ((tsk->tmp.flg.mode & flgProtect) == 0)
-					flg->flags &= ~(tsk->tmp.flg.flags & flags);
-				tsk->tmp.flg.flags &= ~flags;
-				if (tsk->tmp.flg.flags == 0 || (tsk->tmp.flg.mode & flgAll) == 0)
-				{
-					core_tsk_wakeup(tsk, E_SUCCESS);
-					continue;
-				}
+				core_tsk_wakeup(tsk, E_SUCCESS);
+				continue;
 			}
-			obj = &tsk->obj;
 		}
+		obj = &tsk->obj;
+	}
 
-		result = flg->flags;
+	if (flg->flags != 0)
+		core_set_notify(&flg->obj);
+
+	return flg->flags;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned flg_give( flg_t *flg, unsigned flags )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned result;
+
+	assert(flg);
+	assert(flg->obj.res!=RELEASED);
+
+#if OS_FAST_PATH
+	result = atomic_fetch_or((atomic_uint *)&flg->flags, flags) | flags;
+	if (flg->obj.queue == NULL && !core_set_member(&flg->obj))
+		return result;
+#endif
+
+	sys_lock();
+	{
+#if OS_FAST_PATH
+	//	the flags have already been set,
+	//	now pass those not yet consumed to tasks that could have started waiting in the meantime
+		flags &= flg->flags;
+#else
+		flg->flags |= flags;
+#endif
+		result = priv_flg_give(flg, flags);
 	}
 	sys_unlock();
 
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_flg_giveDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	flg_give(obj, (unsigned) arg);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned flg_giveISR( flg_t *flg, unsigned flags )
+/* -------------------------------------------------------------------------- */
+{
+	assert(flg);
+	assert(flg->obj.res!=RELEASED);
+
+	if (core_srv_defer(priv_flg_giveDeferred, flg, flags) != E_SUCCESS)
+		return 0;
+
+	return flags;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
 /* -------------------------------------------------------------------------- */
 unsigned flg_clear( flg_t *flg, unsigned flags )
 /* -------------------------------------------------------------------------- */
@@ -215,6 +215,8 @@ static
 int priv_job_take( job_t *job, fun_t **fun )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcJobTake, job, job->count);
+
 	if (job->count > 0)
 	{
 		*fun = priv_job_getUpdate(job);
@@ -300,11 +302,37 @@ int job_waitUntil( job_t *job, cnt_t time )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+unsigned job_takeMany( job_t *job, fun_t **data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned num = 0;
+
+	assert(job);
+	assert(job->obj.res!=RELEASED);
+	assert(job->data);
+	assert(job->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		core_trc_put(trcJobTake, job, job->count);
+
+		for (; num < count && job->count > 0; num++)
+			data[num] = priv_job_getUpdate(job);
+	}
+	sys_unlock();
+
+	return num;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 int priv_job_give( job_t *job, fun_t *fun )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcJobGive, job, (uintptr_t)fun);
+
 	if (job->count < job->limit)
 	{
 		priv_job_putUpdate(job, fun);
@@ -335,6 +363,35 @@ int job_give( job_t *job, fun_t *fun )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_job_giveDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	return job_give(obj, (fun_t *) arg);
+}
+
+/* -------------------------------------------------------------------------- */
+int job_giveISR( job_t *job, fun_t *fun )
+/* -------------------------------------------------------------------------- */
+{
+	assert(job);
+	assert(job->obj.res!=RELEASED);
+	assert(job->data);
+	assert(job->limit);
+	assert(fun);
+
+	return core_srv_defer(priv_job_giveDeferred, job, (uintptr_t) fun);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
 /* -------------------------------------------------------------------------- */
 int job_sendFor( job_t *job, fun_t *fun, cnt_t delay )
 /* -------------------------------------------------------------------------- */
@@ -407,6 +464,37 @@ void job_push( job_t *job, fun_t *fun )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_job_pushDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	job_push(obj, (fun_t *) arg);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+void job_pushISR( job_t *job, fun_t *fun )
+/* -------------------------------------------------------------------------- */
+{
+	assert(job);
+	assert(job->obj.res!=RELEASED);
+	assert(job->data);
+	assert(job->limit);
+	assert(fun);
+
+	core_srv_defer(priv_job_pushDeferred, job, (uintptr_t) fun);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
 /* -------------------------------------------------------------------------- */
 unsigned job_count( job_t *job )
 /* -------------------------------------------------------------------------- */
@@ -67,7 +67,7 @@ lst_t *lst_create( void )
 
 	sys_lock();
 	{
-		lst = malloc(sizeof(lst_t));
+		lst = core_obj_alloc(cacheLST, sizeof(lst_t));
 		if (lst)
 			priv_lst_init(lst, lst);
 	}
@@ -120,6 +120,8 @@ static
 int priv_lst_take( lst_t *lst, void **data )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcLstTake, lst, 0);
+
 	if (lst->head.next != NULL)
 	{
 		*data = lst->head.next + 1;
@@ -230,3 +232,33 @@ void lst_give( lst_t *lst, void *data )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_lst_giveDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	lst_give(obj, (void *) arg);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+void lst_giveISR( lst_t *lst, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	assert(lst);
+	assert(lst->obj.res!=RELEASED);
+	assert(data);
+
+	if (core_srv_defer(priv_lst_giveDeferred, lst, (uintptr_t) data) != E_SUCCESS)
+		lst_give(lst, data); // the memory object can't be lost
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
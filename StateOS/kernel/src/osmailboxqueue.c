@@ -97,6 +97,11 @@ void priv_box_reset( box_t *box, int event )
 	box->head  = 0;
 	box->tail  = 0;
 
+	box->loaned   = NULL;
+	box->borrowed = NULL;
+
+	core_set_remove(&box->obj);
+
 	core_all_wakeup(box->obj.queue, event);
 }
 
@@ -131,16 +136,35 @@ void box_destroy( box_t *box )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+static
+bool priv_box_canPut( box_t *box )
+/* -------------------------------------------------------------------------- */
+{
+//	the loaned slot is the next one to be filled, it is occupied until it is published
+	return box->loaned == NULL && box->count < box->limit;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_box_canGet( box_t *box )
+/* -------------------------------------------------------------------------- */
+{
+//	the borrowed slot is the next one to be read, it is occupied until it is released
+	return box->borrowed == NULL && box->count > 0;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_box_get( box_t *box, char *data )
 /* -------------------------------------------------------------------------- */
 {
-	size_t size = box->size;
 	size_t i = box->head;
 
-	while (size--)
-		*data++ = box->data[i++];
+	assert(box->borrowed==NULL);
+
+	memcpy(data, &box->data[i], box->size);
+	i += box->size;
 	box->head = (i < box->limit) ? i : 0;
 	box->count -= box->size;
 }
@@ -150,15 +174,51 @@ static
 void priv_box_put( box_t *box, const char *data )
 /* -------------------------------------------------------------------------- */
 {
-	size_t size = box->size;
 	size_t i = box->tail;
 
-	while (size--)
-		box->data[i++] = *data++;
+	assert(box->loaned==NULL);
+
+	memcpy(&box->data[i], data, box->size);
+	i += box->size;
+	box->tail = (i < box->limit) ? i : 0;
+	box->count += box->size;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_box_commit( box_t *box )
+/* -------------------------------------------------------------------------- */
+{
+	size_t i = box->tail + box->size;
+
 	box->tail = (i < box->limit) ? i : 0;
 	box->count += box->size;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+void priv_box_getTask( box_t *box, tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	if (tsk->tmp.box.data.in != NULL)
+		priv_box_get(box, tsk->tmp.box.data.in);
+	else
+	//	the task is waiting to borrow the slot
+		tsk->tmp.box.data.in = box->borrowed = &box->data[box->head];
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_box_putTask( box_t *box, tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	if (tsk->tmp.box.data.out != NULL)
+		priv_box_put(box, tsk->tmp.box.data.out);
+	else
+	//	the task is waiting to loan the slot
+		tsk->tmp.box.data.in = box->loaned = &box->data[box->tail];
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_box_skip( box_t *box )
@@ -172,41 +232,55 @@ void priv_box_skip( box_t *box )
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_box_getUpdate( box_t *box, char *data )
+tsk_t *priv_box_waiter( box_t *box, bool send )
 /* -------------------------------------------------------------------------- */
 {
-	tsk_t *tsk;
+	tsk_t *tsk = box->obj.queue;
 
-	priv_box_get(box, data);
-	tsk = core_one_wakeup(box->obj.queue, E_SUCCESS);
-	if (tsk) priv_box_put(box, tsk->tmp.box.data.out);
+//	while a slot is loaned or borrowed, both sending and receiving tasks can wait in the queue
+	while (tsk != NULL && tsk->tmp.box.send != send)
+		tsk = tsk->obj.queue;
+
+	return tsk;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_box_putUpdate( box_t *box, const char *data )
+void priv_box_update( box_t *box )
 /* -------------------------------------------------------------------------- */
 {
 	tsk_t *tsk;
 
-	priv_box_put(box, data);
-	tsk = core_one_wakeup(box->obj.queue, E_SUCCESS);
-	if (tsk) priv_box_get(box, tsk->tmp.box.data.in);
+	for (;;)
+	{
+		if (priv_box_canGet(box) && (tsk = priv_box_waiter(box, false)) != NULL)
+			priv_box_getTask(box, core_tsk_wakeup(tsk, E_SUCCESS));
+		else
+		if (priv_box_canPut(box) && (tsk = priv_box_waiter(box, true)) != NULL)
+			priv_box_putTask(box, core_tsk_wakeup(tsk, E_SUCCESS));
+		else
+			break;
+	}
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_box_skipUpdate( box_t *box )
+void priv_box_getUpdate( box_t *box, char *data )
 /* -------------------------------------------------------------------------- */
 {
-	tsk_t *tsk;
+	priv_box_get(box, data);
+	priv_box_update(box);
+}
 
-	while (box->count == box->limit)
-	{
-		priv_box_skip(box);
-		tsk = core_one_wakeup(box->obj.queue, E_SUCCESS);
-		if (tsk) priv_box_put(box, tsk->tmp.box.data.out);
-	}
+/* -------------------------------------------------------------------------- */
+static
+void priv_box_putUpdate( box_t *box, const char *data )
+/* -------------------------------------------------------------------------- */
+{
+	priv_box_put(box, data);
+	priv_box_update(box);
+	if (priv_box_canGet(box))
+		core_set_notify(&box->obj);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -214,7 +288,9 @@ static
 int priv_box_take( box_t *box, void *data )
 /* -------------------------------------------------------------------------- */
 {
-	if (box->count > 0)
+	core_trc_put(trcBoxTake, box, box->count);
+
+	if (priv_box_canGet(box))
 	{
 		priv_box_getUpdate(box, data);
 		return E_SUCCESS;
@@ -263,6 +339,7 @@ int box_waitFor( box_t *box, void *data, cnt_t delay )
 		if (result == E_TIMEOUT)
 		{
 			System.cur->tmp.box.data.in = data;
+			System.cur->tmp.box.send = false;
 			result = core_tsk_waitFor(&box->obj.queue, delay);
 		}
 	}
@@ -290,6 +367,7 @@ int box_waitUntil( box_t *box, void *data, cnt_t time )
 		if (result == E_TIMEOUT)
 		{
 			System.cur->tmp.box.data.in = data;
+			System.cur->tmp.box.send = false;
 			result = core_tsk_waitUntil(&box->obj.queue, time);
 		}
 	}
@@ -303,7 +381,9 @@ static
 int priv_box_give( box_t *box, const void *data )
 /* -------------------------------------------------------------------------- */
 {
-	if (box->count < box->limit)
+	core_trc_put(trcBoxGive, box, box->count);
+
+	if (priv_box_canPut(box))
 	{
 		priv_box_putUpdate(box, data);
 		return E_SUCCESS;
@@ -352,6 +432,7 @@ int box_sendFor( box_t *box, const void *data, cnt_t delay )
 		if (result == E_TIMEOUT)
 		{
 			System.cur->tmp.box.data.out = data;
+			System.cur->tmp.box.send = true;
 			result = core_tsk_waitFor(&box->obj.queue, delay);
 		}
 	}
@@ -379,6 +460,7 @@ int box_sendUntil( box_t *box, const void *data, cnt_t time )
 		if (result == E_TIMEOUT)
 		{
 			System.cur->tmp.box.data.out = data;
+			System.cur->tmp.box.send = true;
 			result = core_tsk_waitUntil(&box->obj.queue, time);
 		}
 	}
@@ -399,8 +481,305 @@ void box_push( box_t *box, const void *data )
 
 	sys_lock();
 	{
-		priv_box_skipUpdate(box);
-		priv_box_putUpdate(box, data);
+	//	neither the loaned slot nor the borrowed slot can be overwritten, the mail is dropped then
+		if (box->count == box->limit && box->borrowed == NULL)
+			priv_box_skip(box);
+		if (priv_box_canPut(box))
+			priv_box_putUpdate(box, data);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned box_giveMany( box_t *box, const void *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	const char *ptr = data;
+	unsigned num = 0;
+
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		core_trc_put(trcBoxGive, box, box->count);
+
+		for (; num < count && priv_box_canPut(box); num++, ptr += box->size)
+			priv_box_putUpdate(box, ptr);
+	}
+	sys_unlock();
+
+	return num;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned box_takeMany( box_t *box, void *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	char *ptr = data;
+	unsigned num = 0;
+
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		core_trc_put(trcBoxTake, box, box->count);
+
+		for (; num < count && priv_box_canGet(box); num++, ptr += box->size)
+			priv_box_getUpdate(box, ptr);
+	}
+	sys_unlock();
+
+	return num;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_box_loan( box_t *box, void **slot )
+/* -------------------------------------------------------------------------- */
+{
+	if (priv_box_canPut(box))
+	{
+		*slot = box->loaned = &box->data[box->tail];
+		return E_SUCCESS;
+	}
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+int box_loan( box_t *box, void **slot )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(slot);
+
+	sys_lock();
+	{
+		result = priv_box_loan(box, slot);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int box_loanFor( box_t *box, void **slot, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(slot);
+
+	sys_lock();
+	{
+		result = priv_box_loan(box, slot);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.box.data.out = NULL;
+			System.cur->tmp.box.send = true;
+			result = core_tsk_waitFor(&box->obj.queue, delay);
+			if (result == E_SUCCESS)
+				*slot = System.cur->tmp.box.data.in;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int box_loanUntil( box_t *box, void **slot, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(slot);
+
+	sys_lock();
+	{
+		result = priv_box_loan(box, slot);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.box.data.out = NULL;
+			System.cur->tmp.box.send = true;
+			result = core_tsk_waitUntil(&box->obj.queue, time);
+			if (result == E_SUCCESS)
+				*slot = System.cur->tmp.box.data.in;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+void box_publish( box_t *box, void *slot )
+/* -------------------------------------------------------------------------- */
+{
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+
+	sys_lock();
+	{
+		core_trc_put(trcBoxGive, box, box->count);
+
+		assert(slot==box->loaned);
+
+		if (slot != NULL && slot == box->loaned)
+		{
+			box->loaned = NULL;
+			priv_box_commit(box);
+			priv_box_update(box);
+			if (priv_box_canGet(box))
+				core_set_notify(&box->obj);
+		}
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_box_borrow( box_t *box, void **slot )
+/* -------------------------------------------------------------------------- */
+{
+	if (priv_box_canGet(box))
+	{
+		*slot = box->borrowed = &box->data[box->head];
+		return E_SUCCESS;
+	}
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+int box_borrow( box_t *box, void **slot )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(slot);
+
+	sys_lock();
+	{
+		result = priv_box_borrow(box, slot);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int box_borrowFor( box_t *box, void **slot, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(slot);
+
+	sys_lock();
+	{
+		result = priv_box_borrow(box, slot);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.box.data.in = NULL;
+			System.cur->tmp.box.send = false;
+			result = core_tsk_waitFor(&box->obj.queue, delay);
+			if (result == E_SUCCESS)
+				*slot = System.cur->tmp.box.data.in;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int box_borrowUntil( box_t *box, void **slot, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+	assert(slot);
+
+	sys_lock();
+	{
+		result = priv_box_borrow(box, slot);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.box.data.in = NULL;
+			System.cur->tmp.box.send = false;
+			result = core_tsk_waitUntil(&box->obj.queue, time);
+			if (result == E_SUCCESS)
+				*slot = System.cur->tmp.box.data.in;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+void box_release( box_t *box, void *slot )
+/* -------------------------------------------------------------------------- */
+{
+	assert(box);
+	assert(box->obj.res!=RELEASED);
+	assert(box->data);
+	assert(box->limit);
+
+	sys_lock();
+	{
+		core_trc_put(trcBoxTake, box, box->count);
+
+		assert(slot==box->borrowed);
+
+		if (slot != NULL && slot == box->borrowed)
+		{
+			box->borrowed = NULL;
+			priv_box_skip(box);
+			priv_box_update(box);
+			if (priv_box_canGet(box))
+				core_set_notify(&box->obj);
+		}
 	}
 	sys_unlock();
 }
@@ -491,7 +870,7 @@ int box_takeAsync( box_t *box, void *data )
 
 	sys_lock();
 	{
-		if (atomic_load((atomic_uint *)&box->count) > 0)
+		if (box->borrowed == NULL && atomic_load((atomic_uint *)&box->count) > 0)
 		{
 			priv_box_getAsync(box, data);
 			result = E_SUCCESS;
@@ -542,7 +921,7 @@ int box_giveAsync( box_t *box, const void *data )
 
 	sys_lock();
 	{
-		if (atomic_load((atomic_uint *)&box->count) < box->limit)
+		if (box->loaned == NULL && atomic_load((atomic_uint *)&box->count) < box->limit)
 		{
 			priv_box_putAsync(box, data);
 			result = E_SUCCESS;
@@ -92,6 +92,9 @@ void priv_msg_reset( msg_t *msg, int event )
 	msg->count = 0;
 	msg->head  = 0;
 	msg->tail  = 0;
+	msg->items = 0;
+
+	core_set_remove(&msg->obj);
 
 	core_all_wakeup(msg->obj.queue, event);
 }
@@ -134,12 +137,11 @@ void priv_msg_peek( msg_t *msg, char *data, size_t size )
 /* -------------------------------------------------------------------------- */
 {
 	size_t i = msg->head;
+	size_t n = msg->limit - i;
 
-	while (size--)
-	{
-		*data++ = msg->data[i++];
-		if (i == msg->limit) i = 0;
-	}
+	if (n > size) n = size;
+	memcpy(data, &msg->data[i], n);
+	memcpy(data + n, msg->data, size - n);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -148,13 +150,15 @@ void priv_msg_get( msg_t *msg, char *data, size_t size )
 /* -------------------------------------------------------------------------- */
 {
 	size_t i = msg->head;
+	size_t n = msg->limit - i;
+
+	if (n > size) n = size;
+	memcpy(data, &msg->data[i], n);
+	memcpy(data + n, msg->data, size - n);
 
 	msg->count -= size;
-	while (size--)
-	{
-		*data++ = msg->data[i++];
-		if (i == msg->limit) i = 0;
-	}
+	i += size;
+	if (i >= msg->limit) i -= msg->limit;
 	msg->head = i;
 }
 
@@ -164,14 +168,28 @@ void priv_msg_put( msg_t *msg, const char *data, size_t size )
 /* -------------------------------------------------------------------------- */
 {
 	size_t i = msg->tail;
+	size_t n = msg->limit - i;
+
+	if (n > size) n = size;
+	memcpy(&msg->data[i], data, n);
+	memcpy(msg->data, data + n, size - n);
 
 	msg->count += size;
-	while (size--)
+	i += size;
+	if (i >= msg->limit) i -= msg->limit;
+	msg->tail = i;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_msg_putVec( msg_t *msg, const iov_t *vec, unsigned cnt )
+/* -------------------------------------------------------------------------- */
+{
+	while (cnt--)
 	{
-		msg->data[i++] = *data++;
-		if (i == msg->limit) i = 0;
+		priv_msg_put(msg, vec->data, vec->size);
+		vec++;
 	}
-	msg->tail = i;
 }
 
 /* -------------------------------------------------------------------------- */
@@ -208,6 +226,7 @@ size_t priv_msg_getSize( msg_t *msg )
 	assert(msg->count);
 
 	priv_msg_get(msg, (void *)&size, sizeof(size_t));
+	msg->items--;
 
 	return size;
 }
@@ -218,22 +237,107 @@ void priv_msg_putSize( msg_t *msg, size_t size )
 /* -------------------------------------------------------------------------- */
 {
 	priv_msg_put(msg, (const void *)&size, sizeof(size_t));
+	msg->items++;
 }
 
 /* -------------------------------------------------------------------------- */
 static
-size_t priv_msg_getUpdate( msg_t *msg, char *data )
+size_t priv_msg_vecSize( const iov_t *vec, unsigned cnt )
 /* -------------------------------------------------------------------------- */
 {
-	size_t size = priv_msg_getSize(msg);
-	priv_msg_get(msg, data, size);
+	size_t size = 0;
+
+	while (cnt--)
+		size += vec++->size;
+
+	return size;
+}
 
-	while (msg->obj.queue != 0 && msg->count + sizeof(size_t) + msg->obj.queue->tmp.msg.size <= msg->limit)
+/* -------------------------------------------------------------------------- */
+static
+void priv_msg_putTask( msg_t *msg, tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	priv_msg_putSize(msg, tsk->tmp.msg.size);
+	if (tsk->tmp.msg.cnt > 0)
+		priv_msg_putVec(msg, tsk->tmp.msg.data.vec, tsk->tmp.msg.cnt);
+	else
+		priv_msg_put(msg, tsk->tmp.msg.data.out, tsk->tmp.msg.size);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_msg_getWakeup( msg_t *msg )
+/* -------------------------------------------------------------------------- */
+{
+	while (msg->obj.queue != 0 && msg->obj.queue->tmp.msg.level == 0 && msg->count + sizeof(size_t) + msg->obj.queue->tmp.msg.size <= msg->limit)
 	{
-		priv_msg_putSize(msg, msg->obj.queue->tmp.msg.size);
-		priv_msg_put(msg, msg->obj.queue->tmp.msg.data.out, msg->obj.queue->tmp.msg.size);
+		priv_msg_putTask(msg, msg->obj.queue);
 		core_one_wakeup(msg->obj.queue, E_SUCCESS);
 	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_msg_getTask( msg_t *msg, tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	size_t size;
+
+	if (tsk->tmp.msg.size >= priv_msg_size(msg))
+	{
+		size = priv_msg_getSize(msg);
+		tsk->tmp.msg.size = size;
+		priv_msg_get(msg, tsk->tmp.msg.data.in, size);
+		core_tsk_wakeup(tsk, E_SUCCESS);
+	}
+	else
+	{
+		core_tsk_wakeup(tsk, E_FAILURE);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_msg_putWakeup( msg_t *msg )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk = msg->obj.queue;
+	tsk_t *nxt;
+
+	while (tsk != 0 && tsk->tmp.msg.level > 0 && msg->count > 0)
+	{
+		nxt = tsk->obj.queue;
+		if (msg->items >= tsk->tmp.msg.level)
+			priv_msg_getTask(msg, tsk);
+		else
+		//	trigger level not reached yet, restart the idle timeout of the receiving task
+			core_tsk_rewind(tsk);
+		tsk = nxt;
+	}
+
+	if (msg->count > 0)
+		core_set_notify(&msg->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_msg_flush( msg_t *msg )
+/* -------------------------------------------------------------------------- */
+{
+//	deliver messages to the receiving tasks regardless of their trigger levels
+	while (msg->obj.queue != 0 && msg->obj.queue->tmp.msg.level > 0 && msg->count > 0)
+		priv_msg_getTask(msg, msg->obj.queue);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_msg_getUpdate( msg_t *msg, char *data )
+/* -------------------------------------------------------------------------- */
+{
+	size_t size = priv_msg_getSize(msg);
+	priv_msg_get(msg, data, size);
+	priv_msg_getWakeup(msg);
 
 	return size;
 }
@@ -245,21 +349,17 @@ void priv_msg_putUpdate( msg_t *msg, const char *data, size_t size )
 {
 	priv_msg_putSize(msg, size);
 	priv_msg_put(msg, data, size);
+	priv_msg_putWakeup(msg);
+}
 
-	while (msg->obj.queue != 0 && msg->count > 0)
-	{
-		if (msg->obj.queue->tmp.msg.size >= priv_msg_size(msg))
-		{
-			size = priv_msg_getSize(msg);
-			msg->obj.queue->tmp.msg.size = size;
-			priv_msg_get(msg, msg->obj.queue->tmp.msg.data.in, size);
-			core_one_wakeup(msg->obj.queue, E_SUCCESS);
-		}
-		else
-		{
-			core_one_wakeup(msg->obj.queue, E_FAILURE);
-		}
-	}
+/* -------------------------------------------------------------------------- */
+static
+void priv_msg_putVecUpdate( msg_t *msg, const iov_t *vec, unsigned cnt, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	priv_msg_putSize(msg, size);
+	priv_msg_putVec(msg, vec, cnt);
+	priv_msg_putWakeup(msg);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -270,13 +370,7 @@ void priv_msg_skipUpdate( msg_t *msg, size_t size )
 	while (msg->count + sizeof(size_t) + size > msg->limit)
 	{
 		priv_msg_skip(msg, priv_msg_getSize(msg));
-
-		while (msg->obj.queue != 0 && msg->count + sizeof(size_t) + msg->obj.queue->tmp.msg.size <= msg->limit)
-		{
-			priv_msg_putSize(msg, msg->obj.queue->tmp.msg.size);
-			priv_msg_put(msg, msg->obj.queue->tmp.msg.data.out, msg->obj.queue->tmp.msg.size);
-			core_one_wakeup(msg->obj.queue, E_SUCCESS);
-		}
+		priv_msg_getWakeup(msg);
 	}
 }
 
@@ -285,6 +379,8 @@ static
 int priv_msg_take( msg_t *msg, char *data, size_t size, size_t *read )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcMsgTake, msg, size);
+
 	if (msg->count > 0)
 	{
 		if (size >= priv_msg_size(msg))
@@ -342,6 +438,7 @@ int msg_waitFor( msg_t *msg, void *data, size_t size, size_t *read, cnt_t delay
 		{
 			System.cur->tmp.msg.data.in = data;
 			System.cur->tmp.msg.size = size;
+			System.cur->tmp.msg.level = 1;
 			result = core_tsk_waitFor(&msg->obj.queue, delay);
 			if (result == E_SUCCESS && read != NULL)
 				*read = System.cur->tmp.msg.size;
@@ -372,6 +469,7 @@ int msg_waitUntil( msg_t *msg, void *data, size_t size, size_t *read, cnt_t time
 		{
 			System.cur->tmp.msg.data.in = data;
 			System.cur->tmp.msg.size = size;
+			System.cur->tmp.msg.level = 1;
 			result = core_tsk_waitUntil(&msg->obj.queue, time);
 			if (result == E_SUCCESS && read != NULL)
 				*read = System.cur->tmp.msg.size;
@@ -382,11 +480,54 @@ int msg_waitUntil( msg_t *msg, void *data, size_t size, size_t *read, cnt_t time
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+int msg_waitLevel( msg_t *msg, void *data, size_t size, size_t *read, size_t level, cnt_t idle )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(msg);
+	assert(msg->obj.res!=RELEASED);
+	assert(msg->data);
+	assert(msg->limit);
+	assert(data||size==0);
+	assert(level);
+
+	sys_lock();
+	{
+		result = E_TIMEOUT;
+		if (msg->items >= level)
+			result = priv_msg_take(msg, data, size, read);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.msg.data.in = data;
+			System.cur->tmp.msg.size = size;
+			System.cur->tmp.msg.level = level;
+			result = core_tsk_waitFor(&msg->obj.queue, idle);
+			if (result == E_SUCCESS && read != NULL)
+				*read = System.cur->tmp.msg.size;
+			else
+			if (result == E_TIMEOUT)
+			//	the idle timeout expired, receive the first of the messages available so far
+				result = priv_msg_take(msg, data, size, read);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 int priv_msg_give( msg_t *msg, const char *data, size_t size )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcMsgGive, msg, size);
+
+	if (msg->count + sizeof(size_t) + size > msg->limit)
+		priv_msg_flush(msg);
+
 	if (msg->count + sizeof(size_t) + size <= msg->limit)
 	{
 		priv_msg_putUpdate(msg, data, size);
@@ -440,6 +581,8 @@ int msg_sendFor( msg_t *msg, const void *data, size_t size, cnt_t delay )
 		{
 			System.cur->tmp.msg.data.out = data;
 			System.cur->tmp.msg.size = size;
+			System.cur->tmp.msg.cnt = 0;
+			System.cur->tmp.msg.level = 0;
 			result = core_tsk_waitFor(&msg->obj.queue, delay);
 		}
 	}
@@ -468,6 +611,113 @@ int msg_sendUntil( msg_t *msg, const void *data, size_t size, cnt_t time )
 		{
 			System.cur->tmp.msg.data.out = data;
 			System.cur->tmp.msg.size = size;
+			System.cur->tmp.msg.cnt = 0;
+			System.cur->tmp.msg.level = 0;
+			result = core_tsk_waitUntil(&msg->obj.queue, time);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_msg_giveVec( msg_t *msg, const iov_t *vec, unsigned cnt )
+/* -------------------------------------------------------------------------- */
+{
+	size_t size = priv_msg_vecSize(vec, cnt);
+
+	core_trc_put(trcMsgGive, msg, size);
+
+	if (msg->count + sizeof(size_t) + size > msg->limit)
+		priv_msg_flush(msg);
+
+	if (msg->count + sizeof(size_t) + size <= msg->limit)
+	{
+		priv_msg_putVecUpdate(msg, vec, cnt, size);
+		return E_SUCCESS;
+	}
+
+	if (sizeof(size_t) + size <= msg->limit)
+		return E_TIMEOUT;
+
+	return E_FAILURE;
+}
+
+/* -------------------------------------------------------------------------- */
+int msg_givev( msg_t *msg, const iov_t *vec, unsigned cnt )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(msg);
+	assert(msg->obj.res!=RELEASED);
+	assert(msg->data);
+	assert(msg->limit);
+	assert(vec||cnt==0);
+
+	sys_lock();
+	{
+		result = priv_msg_giveVec(msg, vec, cnt);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int msg_sendvFor( msg_t *msg, const iov_t *vec, unsigned cnt, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(msg);
+	assert(msg->obj.res!=RELEASED);
+	assert(msg->data);
+	assert(msg->limit);
+	assert(vec||cnt==0);
+
+	sys_lock();
+	{
+		result = priv_msg_giveVec(msg, vec, cnt);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.msg.data.vec = vec;
+			System.cur->tmp.msg.size = priv_msg_vecSize(vec, cnt);
+			System.cur->tmp.msg.cnt = cnt;
+			System.cur->tmp.msg.level = 0;
+			result = core_tsk_waitFor(&msg->obj.queue, delay);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int msg_sendvUntil( msg_t *msg, const iov_t *vec, unsigned cnt, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(msg);
+	assert(msg->obj.res!=RELEASED);
+	assert(msg->data);
+	assert(msg->limit);
+	assert(vec||cnt==0);
+
+	sys_lock();
+	{
+		result = priv_msg_giveVec(msg, vec, cnt);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.msg.data.vec = vec;
+			System.cur->tmp.msg.size = priv_msg_vecSize(vec, cnt);
+			System.cur->tmp.msg.cnt = cnt;
+			System.cur->tmp.msg.level = 0;
 			result = core_tsk_waitUntil(&msg->obj.queue, time);
 		}
 	}
@@ -476,6 +726,64 @@ int msg_sendUntil( msg_t *msg, const void *data, size_t size, cnt_t time )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+int msg_acquire( msg_t *msg, iov_t *vec )
+/* -------------------------------------------------------------------------- */
+{
+	size_t i, n, size;
+	int result = E_TIMEOUT;
+
+	assert(msg);
+	assert(msg->obj.res!=RELEASED);
+	assert(msg->data);
+	assert(msg->limit);
+	assert(vec);
+
+	sys_lock();
+	{
+		if (msg->count > 0)
+		{
+		//	the message can wrap around the end of the buffer
+			size = priv_msg_size(msg);
+			i = msg->head + sizeof(size_t);
+			if (i >= msg->limit) i -= msg->limit;
+			n = msg->limit - i;
+			if (n > size) n = size;
+			vec[0].data = &msg->data[i];
+			vec[0].size = n;
+			vec[1].data = msg->data;
+			vec[1].size = size - n;
+			result = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+void msg_release( msg_t *msg )
+/* -------------------------------------------------------------------------- */
+{
+	size_t size;
+
+	assert(msg);
+	assert(msg->obj.res!=RELEASED);
+	assert(msg->data);
+	assert(msg->limit);
+
+	sys_lock();
+	{
+		assert(msg->count);
+
+		size = priv_msg_getSize(msg);
+		core_trc_put(trcMsgTake, msg, size);
+		priv_msg_skip(msg, size);
+		priv_msg_getWakeup(msg);
+	}
+	sys_unlock();
+}
+
 /* -------------------------------------------------------------------------- */
 static
 int priv_msg_push( msg_t *msg, const void *data, size_t size )
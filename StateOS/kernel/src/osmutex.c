@@ -73,7 +73,7 @@ mtx_t *mtx_create( unsigned mode, unsigned prio )
 
 	sys_lock();
 	{
-		mtx = malloc(sizeof(mtx_t));
+		mtx = core_obj_alloc(cacheMTX, sizeof(mtx_t));
 		if (mtx)
 			priv_mtx_init(mtx, mode, prio, mtx);
 	}
@@ -155,6 +155,8 @@ static
 int priv_mtx_take( mtx_t *mtx )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcMtxTake, mtx, (uintptr_t)mtx->owner);
+
 	if ((mtx->mode & mtxPrioMASK) == mtxPrioProtect && mtx->prio < System.cur->prio)
 		return E_FAILURE;
 
@@ -274,6 +276,8 @@ static
 int priv_mtx_give( mtx_t *mtx )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcMtxGive, mtx, (uintptr_t)mtx->owner);
+
 	if ((mtx->mode & (mtxTypeMASK + mtxRobust)) == mtxNormal || mtx->owner == System.cur)
 	{
 		if (mtx->count > 0)
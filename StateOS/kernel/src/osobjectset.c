@@ -0,0 +1,363 @@
+/******************************************************************************
+
+    @file    StateOS: osobjectset.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/osobjectset.h"
+#include "inc/ossemaphore.h"
+#include "inc/osflag.h"
+#include "inc/osmailboxqueue.h"
+#include "inc/oseventqueue.h"
+#include "inc/ospriorityqueue.h"
+#include "inc/osstreambuffer.h"
+#include "inc/osmessagebuffer.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+#if OS_OBJ_SET
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_set_init( set_t *set, sme_t *data, size_t bufsize, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(set, 0, sizeof(set_t));
+
+	core_obj_init(&set->obj, res);
+
+	set->limit = (unsigned)(bufsize / sizeof(sme_t));
+	set->data  = data;
+}
+
+/* -------------------------------------------------------------------------- */
+void set_init( set_t *set, sme_t *data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(set);
+	assert(data);
+	assert(bufsize);
+
+	sys_lock();
+	{
+		priv_set_init(set, data, bufsize, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+set_t *set_create( unsigned limit )
+/* -------------------------------------------------------------------------- */
+{
+	struct set_T { set_t set; sme_t buf[]; } *tmp;
+	set_t *set = NULL;
+	size_t bufsize;
+
+	assert_tsk_context();
+	assert(limit);
+
+	sys_lock();
+	{
+		bufsize = limit * sizeof(sme_t);
+		tmp = malloc(sizeof(struct set_T) + bufsize);
+		if (tmp)
+			priv_set_init(set = &tmp->set, tmp->buf, bufsize, tmp);
+	}
+	sys_unlock();
+
+	return set;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_set_reset( set_t *set, int event )
+/* -------------------------------------------------------------------------- */
+{
+	while (set->count > 0)
+		set->data[--set->count].obj->set = NULL;
+
+	set->next = 0;
+
+	core_all_wakeup(set->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void set_reset( set_t *set )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(set);
+	assert(set->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_set_reset(set, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void set_destroy( set_t *set )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(set);
+	assert(set->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_set_reset(set, set->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&set->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_set_ready( sme_t *sme )
+/* -------------------------------------------------------------------------- */
+{
+	switch (sme->type)
+	{
+	case setSEM: return ((sem_t *) sme->obj)->count > 0;
+	case setFLG: return ((flg_t *) sme->obj)->flags != 0;
+	case setBOX: return ((box_t *) sme->obj)->count > 0 && ((box_t *) sme->obj)->borrowed == NULL;
+	case setEVQ: return ((evq_t *) sme->obj)->count > 0;
+	case setPRQ: return ((prq_t *) sme->obj)->count > 0;
+	case setSTM: return ((stm_t *) sme->obj)->count > 0;
+	case setMSG: return ((msg_t *) sme->obj)->count > 0;
+	default:     return false;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+int set_add( set_t *set, void *obj, unsigned type )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_FAILURE;
+
+	assert_tsk_context();
+	assert(set);
+	assert(set->obj.res!=RELEASED);
+	assert(set->data);
+	assert(obj);
+	assert(type<=setMSG);
+
+	sys_lock();
+	{
+		if (set->count < set->limit && ((obj_t *) obj)->set == NULL)
+		{
+			set->data[set->count].obj  = obj;
+			set->data[set->count].type = type;
+			set->count++;
+			((obj_t *) obj)->set = set;
+			result = E_SUCCESS;
+		//	the new member may be ready already
+			if (priv_set_ready(&set->data[set->count - 1]))
+				core_set_wakeup(obj);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int set_remove( set_t *set, void *obj )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_FAILURE;
+
+	assert_tsk_context();
+	assert(set);
+	assert(set->obj.res!=RELEASED);
+	assert(set->data);
+	assert(obj);
+
+	sys_lock();
+	{
+		if (((obj_t *) obj)->set == set)
+		{
+			core_set_unlink(obj);
+			result = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_set_take( set_t *set, void **obj )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned i, n;
+
+	for (n = 0; n < set->count; n++)
+	{
+		i = set->next + n;
+		if (i >= set->count)
+			i -= set->count;
+		if (priv_set_ready(&set->data[i]))
+		{
+		//	the next check starts from the following member
+			set->next = (i + 1 < set->count) ? i + 1 : 0;
+			*obj = set->data[i].obj;
+			return E_SUCCESS;
+		}
+	}
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+int set_take( set_t *set, void **obj )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(set);
+	assert(set->obj.res!=RELEASED);
+	assert(set->data);
+	assert(obj);
+
+	sys_lock();
+	{
+		result = priv_set_take(set, obj);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int set_waitFor( set_t *set, void **obj, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(set);
+	assert(set->obj.res!=RELEASED);
+	assert(set->data);
+	assert(obj);
+
+	sys_lock();
+	{
+		result = priv_set_take(set, obj);
+		if (result == E_TIMEOUT)
+		{
+			result = core_tsk_waitFor(&set->obj.queue, delay);
+			if (result == E_SUCCESS)
+				*obj = System.cur->tmp.set.obj;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int set_waitUntil( set_t *set, void **obj, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(set);
+	assert(set->obj.res!=RELEASED);
+	assert(set->data);
+	assert(obj);
+
+	sys_lock();
+	{
+		result = priv_set_take(set, obj);
+		if (result == E_TIMEOUT)
+		{
+			result = core_tsk_waitUntil(&set->obj.queue, time);
+			if (result == E_SUCCESS)
+				*obj = System.cur->tmp.set.obj;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned set_count( set_t *set )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(set);
+	assert(set->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		count = set->count;
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+void core_set_wakeup( obj_t *obj )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk = core_one_wakeup(obj->set->obj.queue, E_SUCCESS);
+
+	if (tsk)
+		tsk->tmp.set.obj = obj;
+}
+
+/* -------------------------------------------------------------------------- */
+void core_set_unlink( obj_t *obj )
+/* -------------------------------------------------------------------------- */
+{
+	set_t *set = obj->set;
+	unsigned i;
+
+	for (i = 0; i < set->count; i++)
+	{
+		if (set->data[i].obj == obj)
+		{
+			set->data[i] = set->data[--set->count];
+			break;
+		}
+	}
+
+	obj->set = NULL;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_OBJ_SET
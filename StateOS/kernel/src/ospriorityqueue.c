@@ -0,0 +1,477 @@
+/******************************************************************************
+
+    @file    StateOS: ospriorityqueue.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/ospriorityqueue.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_prq_init( prq_t *prq, size_t size, void *data, size_t bufsize, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned limit = (unsigned)(bufsize / (sizeof(prn_t) + size));
+
+	memset(prq, 0, sizeof(prq_t));
+
+	core_obj_init(&prq->obj, res);
+
+	prq->limit = limit;
+	prq->size  = size;
+	prq->node  = data;
+	prq->data  = (char *)(prq->node + limit);
+}
+
+/* -------------------------------------------------------------------------- */
+void prq_init( prq_t *prq, size_t size, void *data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(prq);
+	assert(size);
+	assert(data);
+	assert(bufsize);
+
+	sys_lock();
+	{
+		priv_prq_init(prq, size, data, bufsize, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+prq_t *prq_create( unsigned limit, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	struct prq_T { prq_t prq; prn_t buf[]; } *tmp;
+	prq_t *prq = NULL;
+	size_t bufsize;
+
+	assert_tsk_context();
+	assert(limit);
+	assert(size);
+
+	sys_lock();
+	{
+		bufsize = PRQ_SIZE(limit, size);
+		tmp = malloc(sizeof(struct prq_T) + bufsize);
+		if (tmp)
+			priv_prq_init(prq = &tmp->prq, size, tmp->buf, bufsize, tmp);
+	}
+	sys_unlock();
+
+	return prq;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_prq_reset( prq_t *prq, int event )
+/* -------------------------------------------------------------------------- */
+{
+	prq->count = 0;
+	prq->used  = 0;
+
+	core_set_remove(&prq->obj);
+
+	core_all_wakeup(prq->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void prq_reset( prq_t *prq )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_prq_reset(prq, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void prq_destroy( prq_t *prq )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_prq_reset(prq, prq->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&prq->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_prq_before( const prn_t *node, const prn_t *next )
+/* -------------------------------------------------------------------------- */
+{
+	if (node->prio != next->prio)
+		return node->prio > next->prio;
+
+//	mails with the same priority are kept in fifo order
+	return (int)(node->seq - next->seq) < 0;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_prq_get( prq_t *prq, char *data, unsigned *prio )
+/* -------------------------------------------------------------------------- */
+{
+	prn_t    top = prq->node[0];
+	prn_t    end;
+	unsigned i, n;
+
+	memcpy(data, &prq->data[top.slot * prq->size], prq->size);
+	if (prio) *prio = top.prio;
+
+//	move the last node of the heap down from the root
+	end = prq->node[--prq->count];
+	for (i = 0; (n = i * 2 + 1) < prq->count; i = n)
+	{
+		if (n + 1 < prq->count && priv_prq_before(&prq->node[n + 1], &prq->node[n]))
+			n++;
+		if (!priv_prq_before(&prq->node[n], &end))
+			break;
+		prq->node[i] = prq->node[n];
+	}
+	prq->node[i] = end;
+
+//	the released slot is stored just behind the heap
+	prq->node[prq->count].slot = top.slot;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_prq_put( prq_t *prq, const char *data, unsigned prio )
+/* -------------------------------------------------------------------------- */
+{
+	prn_t    top;
+	unsigned i, n;
+
+//	slots behind the heap are free, slots above 'used' were never used
+	top.prio = prio;
+	top.seq  = prq->seq++;
+	top.slot = (prq->count < prq->used) ? prq->node[prq->count].slot : prq->used++;
+
+	memcpy(&prq->data[top.slot * prq->size], data, prq->size);
+
+//	move the new node up from the end of the heap
+	for (i = prq->count++; i > 0; i = n)
+	{
+		n = (i - 1) / 2;
+		if (!priv_prq_before(&top, &prq->node[n]))
+			break;
+		prq->node[i] = prq->node[n];
+	}
+	prq->node[i] = top;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_prq_getUpdate( prq_t *prq, char *data, unsigned *prio )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk;
+
+	priv_prq_get(prq, data, prio);
+	tsk = core_one_wakeup(prq->obj.queue, E_SUCCESS);
+	if (tsk) priv_prq_put(prq, tsk->tmp.prq.data.out, tsk->tmp.prq.prio);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_prq_putUpdate( prq_t *prq, const char *data, unsigned prio )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk;
+
+	priv_prq_put(prq, data, prio);
+	tsk = core_one_wakeup(prq->obj.queue, E_SUCCESS);
+	if (tsk) priv_prq_get(prq, tsk->tmp.prq.data.in, &tsk->tmp.prq.prio);
+	else     core_set_notify(&prq->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_prq_take( prq_t *prq, void *data, unsigned *prio )
+/* -------------------------------------------------------------------------- */
+{
+	core_trc_put(trcPrqTake, prq, prq->count);
+
+	if (prq->count > 0)
+	{
+		priv_prq_getUpdate(prq, data, prio);
+		return E_SUCCESS;
+	}
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+int prq_take( prq_t *prq, void *data, unsigned *prio )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+	assert(prq->node);
+	assert(prq->data);
+	assert(prq->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_prq_take(prq, data, prio);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int prq_waitFor( prq_t *prq, void *data, unsigned *prio, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+	assert(prq->node);
+	assert(prq->data);
+	assert(prq->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_prq_take(prq, data, prio);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.prq.data.in = data;
+			result = core_tsk_waitFor(&prq->obj.queue, delay);
+			if (result == E_SUCCESS && prio != NULL)
+				*prio = System.cur->tmp.prq.prio;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int prq_waitUntil( prq_t *prq, void *data, unsigned *prio, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+	assert(prq->node);
+	assert(prq->data);
+	assert(prq->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_prq_take(prq, data, prio);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.prq.data.in = data;
+			result = core_tsk_waitUntil(&prq->obj.queue, time);
+			if (result == E_SUCCESS && prio != NULL)
+				*prio = System.cur->tmp.prq.prio;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_prq_give( prq_t *prq, const void *data, unsigned prio )
+/* -------------------------------------------------------------------------- */
+{
+	core_trc_put(trcPrqGive, prq, prio);
+
+	if (prq->count < prq->limit)
+	{
+		priv_prq_putUpdate(prq, data, prio);
+		return E_SUCCESS;
+	}
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+int prq_give( prq_t *prq, const void *data, unsigned prio )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+	assert(prq->node);
+	assert(prq->data);
+	assert(prq->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_prq_give(prq, data, prio);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int prq_sendFor( prq_t *prq, const void *data, unsigned prio, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+	assert(prq->node);
+	assert(prq->data);
+	assert(prq->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_prq_give(prq, data, prio);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.prq.data.out = data;
+			System.cur->tmp.prq.prio = prio;
+			result = core_tsk_waitFor(&prq->obj.queue, delay);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int prq_sendUntil( prq_t *prq, const void *data, unsigned prio, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+	assert(prq->node);
+	assert(prq->data);
+	assert(prq->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_prq_give(prq, data, prio);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.prq.data.out = data;
+			System.cur->tmp.prq.prio = prio;
+			result = core_tsk_waitUntil(&prq->obj.queue, time);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned prq_count( prq_t *prq )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		count = prq->count;
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned prq_space( prq_t *prq )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned space;
+
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		space = prq->limit - prq->count;
+	}
+	sys_unlock();
+
+	return space;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned prq_limit( prq_t *prq )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned limit;
+
+	assert(prq);
+	assert(prq->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		limit = prq->limit;
+	}
+	sys_unlock();
+
+	return limit;
+}
+
+/* -------------------------------------------------------------------------- */
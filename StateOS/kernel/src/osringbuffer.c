@@ -0,0 +1,436 @@
+/******************************************************************************
+
+    @file    StateOS: osringbuffer.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/osringbuffer.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+#if OS_ATOMICS
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rbf_init( rbf_t *rbf, size_t size, void *data, size_t bufsize, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(rbf, 0, sizeof(rbf_t));
+
+	core_obj_init(&rbf->obj, res);
+
+	rbf->limit = (unsigned)(bufsize / size);
+	rbf->size  = size;
+	rbf->data  = data;
+}
+
+/* -------------------------------------------------------------------------- */
+void rbf_init( rbf_t *rbf, size_t size, void *data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rbf);
+	assert(size);
+	assert(data);
+	assert(bufsize);
+
+	sys_lock();
+	{
+		priv_rbf_init(rbf, size, data, bufsize, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+rbf_t *rbf_create( unsigned limit, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	struct rbf_T { rbf_t rbf; char buf[]; } *tmp;
+	rbf_t *rbf = NULL;
+	size_t bufsize;
+
+	assert_tsk_context();
+	assert(limit);
+	assert(size);
+
+	sys_lock();
+	{
+		bufsize = limit * size;
+		tmp = malloc(sizeof(struct rbf_T) + bufsize);
+		if (tmp)
+			priv_rbf_init(rbf = &tmp->rbf, size, tmp->buf, bufsize, tmp);
+	}
+	sys_unlock();
+
+	return rbf;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rbf_reset( rbf_t *rbf, int event )
+/* -------------------------------------------------------------------------- */
+{
+	atomic_store((atomic_uint *)&rbf->head, 0);
+	atomic_store((atomic_uint *)&rbf->tail, 0);
+
+	core_all_wakeup(rbf->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void rbf_reset( rbf_t *rbf )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_rbf_reset(rbf, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void rbf_destroy( rbf_t *rbf )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_rbf_reset(rbf, rbf->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&rbf->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+/* positions of the head and the tail are in the range 0 .. 2 * limit - 1,      */
+/* so the full ring buffer can be distinguished from the empty one              */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_rbf_count( rbf_t *rbf, unsigned head, unsigned tail )
+/* -------------------------------------------------------------------------- */
+{
+	return (tail >= head) ? tail - head : tail + 2 * rbf->limit - head;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_rbf_next( rbf_t *rbf, unsigned pos, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	pos += count;
+	return (pos < 2 * rbf->limit) ? pos : pos - 2 * rbf->limit;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rbf_get( rbf_t *rbf, unsigned head, char *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned i = (head < rbf->limit) ? head : head - rbf->limit;
+	unsigned n = (count < rbf->limit - i) ? count : rbf->limit - i;
+
+	memcpy(data, &rbf->data[i * rbf->size], n * rbf->size);
+	memcpy(&data[n * rbf->size], rbf->data, (count - n) * rbf->size);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rbf_put( rbf_t *rbf, unsigned tail, const char *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned i = (tail < rbf->limit) ? tail : tail - rbf->limit;
+	unsigned n = (count < rbf->limit - i) ? count : rbf->limit - i;
+
+	memcpy(&rbf->data[i * rbf->size], data, n * rbf->size);
+	memcpy(rbf->data, &data[n * rbf->size], (count - n) * rbf->size);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_rbf_wakeup( rbf_t *rbf )
+/* -------------------------------------------------------------------------- */
+{
+//	the full barrier orders the update of the position before reading the flag,
+//	the waiting task sets the flag before checking the position in the critical section
+	atomic_thread_fence(memory_order_seq_cst);
+
+	if (atomic_load_explicit((atomic_uint *)&rbf->wait, memory_order_relaxed) &&
+	    atomic_exchange((atomic_uint *)&rbf->wait, 0))
+	{
+		sys_lock();
+		{
+			core_one_wakeup(rbf->obj.queue, E_SUCCESS);
+		}
+		sys_unlock();
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_rbf_read( rbf_t *rbf, void *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned head = atomic_load_explicit((atomic_uint *)&rbf->head, memory_order_relaxed);
+	unsigned tail = atomic_load_explicit((atomic_uint *)&rbf->tail, memory_order_acquire);
+	unsigned size = priv_rbf_count(rbf, head, tail);
+
+	if (count > size)
+		count = size;
+
+	if (count > 0)
+	{
+		priv_rbf_get(rbf, head, data, count);
+		atomic_store_explicit((atomic_uint *)&rbf->head, priv_rbf_next(rbf, head, count), memory_order_release);
+		priv_rbf_wakeup(rbf);
+	}
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned priv_rbf_write( rbf_t *rbf, const void *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned tail = atomic_load_explicit((atomic_uint *)&rbf->tail, memory_order_relaxed);
+	unsigned head = atomic_load_explicit((atomic_uint *)&rbf->head, memory_order_acquire);
+	unsigned size = rbf->limit - priv_rbf_count(rbf, head, tail);
+
+	if (count > size)
+		count = size;
+
+	if (count > 0)
+	{
+		priv_rbf_put(rbf, tail, data, count);
+		atomic_store_explicit((atomic_uint *)&rbf->tail, priv_rbf_next(rbf, tail, count), memory_order_release);
+		priv_rbf_wakeup(rbf);
+	}
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_rbf_suspend( rbf_t *rbf, unsigned count, int (*wait)( tsk_t **, cnt_t ), cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_SUCCESS;
+
+	sys_lock();
+	{
+	//	the task waits only while the ring buffer still contains 'count' elements,
+	//	the other side will see the flag after updating its position
+		atomic_store((atomic_uint *)&rbf->wait, 1);
+		if (priv_rbf_count(rbf, atomic_load((atomic_uint *)&rbf->head),
+		                        atomic_load((atomic_uint *)&rbf->tail)) == count)
+			result = wait(&rbf->obj.queue, time);
+	//	the other side may have blocked in the meantime and set the flag again
+		if (rbf->obj.queue == NULL)
+			atomic_store((atomic_uint *)&rbf->wait, 0);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int rbf_take( rbf_t *rbf, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+	assert(rbf->data);
+	assert(rbf->limit);
+	assert(data);
+
+	return priv_rbf_read(rbf, data, 1) ? E_SUCCESS : E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_rbf_wait( rbf_t *rbf, void *data, int (*wait)( tsk_t **, cnt_t ), cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_SUCCESS;
+
+	while (result == E_SUCCESS && priv_rbf_read(rbf, data, 1) == 0)
+		result = priv_rbf_suspend(rbf, 0, wait, time);
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int rbf_waitFor( rbf_t *rbf, void *data, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+	assert(rbf->data);
+	assert(rbf->limit);
+	assert(data);
+
+	return priv_rbf_wait(rbf, data, core_tsk_waitFor, delay);
+}
+
+/* -------------------------------------------------------------------------- */
+int rbf_waitUntil( rbf_t *rbf, void *data, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+	assert(rbf->data);
+	assert(rbf->limit);
+	assert(data);
+
+	return priv_rbf_wait(rbf, data, core_tsk_waitUntil, time);
+}
+
+/* -------------------------------------------------------------------------- */
+int rbf_give( rbf_t *rbf, const void *data )
+/* -------------------------------------------------------------------------- */
+{
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+	assert(rbf->data);
+	assert(rbf->limit);
+	assert(data);
+
+	return priv_rbf_write(rbf, data, 1) ? E_SUCCESS : E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_rbf_send( rbf_t *rbf, const void *data, int (*wait)( tsk_t **, cnt_t ), cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_SUCCESS;
+
+	while (result == E_SUCCESS && priv_rbf_write(rbf, data, 1) == 0)
+		result = priv_rbf_suspend(rbf, rbf->limit, wait, time);
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int rbf_sendFor( rbf_t *rbf, const void *data, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+	assert(rbf->data);
+	assert(rbf->limit);
+	assert(data);
+
+	return priv_rbf_send(rbf, data, core_tsk_waitFor, delay);
+}
+
+/* -------------------------------------------------------------------------- */
+int rbf_sendUntil( rbf_t *rbf, const void *data, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+	assert(rbf->data);
+	assert(rbf->limit);
+	assert(data);
+
+	return priv_rbf_send(rbf, data, core_tsk_waitUntil, time);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rbf_read( rbf_t *rbf, void *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+	assert(rbf->data);
+	assert(rbf->limit);
+	assert(data);
+
+	return priv_rbf_read(rbf, data, count);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rbf_write( rbf_t *rbf, const void *data, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+	assert(rbf->data);
+	assert(rbf->limit);
+	assert(data);
+
+	return priv_rbf_write(rbf, data, count);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rbf_count( rbf_t *rbf )
+/* -------------------------------------------------------------------------- */
+{
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+
+	return priv_rbf_count(rbf, atomic_load((atomic_uint *)&rbf->head),
+	                           atomic_load((atomic_uint *)&rbf->tail));
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rbf_space( rbf_t *rbf )
+/* -------------------------------------------------------------------------- */
+{
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+
+	return rbf->limit - rbf_count(rbf);
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned rbf_limit( rbf_t *rbf )
+/* -------------------------------------------------------------------------- */
+{
+	assert(rbf);
+	assert(rbf->obj.res!=RELEASED);
+
+	return rbf->limit;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_ATOMICS
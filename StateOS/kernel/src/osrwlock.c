@@ -66,7 +66,7 @@ rwl_t *rwl_create( void )
 
 	sys_lock();
 	{
-		rwl = malloc(sizeof(rwl_t));
+		rwl = core_obj_alloc(cacheRWL, sizeof(rwl_t));
 		if (rwl)
 			priv_rwl_init(rwl, rwl);
 	}
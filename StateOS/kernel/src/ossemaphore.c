@@ -70,7 +70,7 @@ sem_t *sem_create( unsigned init, unsigned limit )
 
 	sys_lock();
 	{
-		sem = malloc(sizeof(sem_t));
+		sem = core_obj_alloc(cacheSEM, sizeof(sem_t));
 		if (sem)
 			priv_sem_init(sem, init, limit, sem);
 	}
@@ -86,6 +86,8 @@ void priv_sem_reset( sem_t *sem, int event )
 {
 	sem->count = 0;
 
+	core_set_remove(&sem->obj);
+
 	core_all_wakeup(sem->obj.queue, event);
 }
 
@@ -120,11 +122,75 @@ void sem_destroy( sem_t *sem )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_FAST_PATH
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_sem_takeFast( sem_t *sem )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count = atomic_load((atomic_uint *)&sem->count);
+
+	while (count > 0)
+		if (atomic_compare_exchange_weak((atomic_uint *)&sem->count, &count, count - 1))
+			return E_SUCCESS;
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_sem_update( sem_t *sem )
+/* -------------------------------------------------------------------------- */
+{
+	while (sem->count > 0 && core_one_wakeup(sem->obj.queue, E_SUCCESS) != NULL)
+		sem->count--;
+
+	if (sem->count > 0)
+		core_set_notify(&sem->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_sem_giveFast( sem_t *sem )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count = atomic_load((atomic_uint *)&sem->count);
+
+	while (count < sem->limit)
+	{
+		if (atomic_compare_exchange_weak((atomic_uint *)&sem->count, &count, count + 1))
+		{
+		//	the counter has already been released,
+		//	now pass it to a task that could have started waiting in the meantime
+			if (sem->obj.queue != NULL || (count == 0 && core_set_member(&sem->obj)))
+			{
+				sys_lock();
+				{
+					priv_sem_update(sem);
+				}
+				sys_unlock();
+			}
+			return E_SUCCESS;
+		}
+	}
+
+	return E_TIMEOUT;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_FAST_PATH
+
 /* -------------------------------------------------------------------------- */
 static
 int priv_sem_take( sem_t *sem )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcSemTake, sem, sem->count);
+
 	if (sem->count == 0)
 		return E_TIMEOUT;
 
@@ -142,6 +208,11 @@ int sem_take( sem_t *sem )
 	assert(sem->obj.res!=RELEASED);
 	assert(sem->count<=sem->limit);
 
+#if OS_FAST_PATH
+	if (priv_sem_takeFast(sem) == E_SUCCESS)
+		return E_SUCCESS;
+#endif
+
 	sys_lock();
 	{
 		result = priv_sem_take(sem);
@@ -162,6 +233,11 @@ int sem_waitFor( sem_t *sem, cnt_t delay )
 	assert(sem->obj.res!=RELEASED);
 	assert(sem->count<=sem->limit);
 
+#if OS_FAST_PATH
+	if (priv_sem_takeFast(sem) == E_SUCCESS)
+		return E_SUCCESS;
+#endif
+
 	sys_lock();
 	{
 		result = priv_sem_take(sem);
@@ -184,6 +260,11 @@ int sem_waitUntil( sem_t *sem, cnt_t time )
 	assert(sem->obj.res!=RELEASED);
 	assert(sem->count<=sem->limit);
 
+#if OS_FAST_PATH
+	if (priv_sem_takeFast(sem) == E_SUCCESS)
+		return E_SUCCESS;
+#endif
+
 	sys_lock();
 	{
 		result = priv_sem_take(sem);
@@ -195,11 +276,35 @@ int sem_waitUntil( sem_t *sem, cnt_t time )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+unsigned sem_takeN( sem_t *sem, unsigned num )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(sem);
+	assert(sem->obj.res!=RELEASED);
+	assert(sem->count<=sem->limit);
+
+	sys_lock();
+	{
+		core_trc_put(trcSemTake, sem, sem->count);
+
+		count = (num < sem->count) ? num : sem->count;
+		sem->count -= count;
+	}
+	sys_unlock();
+
+	return count;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 int priv_sem_give( sem_t *sem )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcSemGive, sem, sem->count);
+
 	if (core_one_wakeup(sem->obj.queue, E_SUCCESS) != NULL)
 		return E_SUCCESS;
 
@@ -207,6 +312,7 @@ int priv_sem_give( sem_t *sem )
 		return E_TIMEOUT;
 
 	sem->count++;
+	core_set_notify(&sem->obj);
 	return E_SUCCESS;
 }
 
@@ -220,6 +326,11 @@ int sem_give( sem_t *sem )
 	assert(sem->obj.res!=RELEASED);
 	assert(sem->count<=sem->limit);
 
+#if OS_FAST_PATH
+	if (priv_sem_giveFast(sem) == E_SUCCESS)
+		return E_SUCCESS;
+#endif
+
 	sys_lock();
 	{
 		result = priv_sem_give(sem);
@@ -229,6 +340,66 @@ int sem_give( sem_t *sem )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+unsigned sem_giveN( sem_t *sem, unsigned num )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count = 0;
+
+	assert(sem);
+	assert(sem->obj.res!=RELEASED);
+	assert(sem->count<=sem->limit);
+
+	sys_lock();
+	{
+		core_trc_put(trcSemGive, sem, sem->count);
+
+		while (count < num && core_one_wakeup(sem->obj.queue, E_SUCCESS) != NULL)
+			count++;
+
+		num -= count;
+		if (num > sem->limit - sem->count)
+			num = sem->limit - sem->count;
+		sem->count += num;
+		count += num;
+
+		if (num > 0)
+			core_set_notify(&sem->obj);
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_sem_giveDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	(void) arg;
+
+	return sem_give(obj);
+}
+
+/* -------------------------------------------------------------------------- */
+int sem_giveISR( sem_t *sem )
+/* -------------------------------------------------------------------------- */
+{
+	assert(sem);
+	assert(sem->obj.res!=RELEASED);
+	assert(sem->count<=sem->limit);
+
+	return core_srv_defer(priv_sem_giveDeferred, sem, 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
 /* -------------------------------------------------------------------------- */
 unsigned sem_getValue( sem_t *sem )
 /* -------------------------------------------------------------------------- */
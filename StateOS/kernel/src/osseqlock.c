@@ -0,0 +1,240 @@
+/******************************************************************************
+
+    @file    StateOS: osseqlock.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+
+#include "inc/osseqlock.h"
+#include "inc/oscriticalsection.h"
+
+#if OS_ATOMICS
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_seq_init( seq_t *seq, unsigned limit, void *data, size_t bufsize, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(seq, 0, sizeof(seq_t));
+
+	core_obj_init(&seq->obj, res);
+
+	seq->limit = limit;
+	seq->size  = bufsize / limit;
+	seq->data  = data;
+}
+
+/* -------------------------------------------------------------------------- */
+void seq_init( seq_t *seq, unsigned limit, void *data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(seq);
+	assert(limit==seqSingle || limit==seqDouble);
+	assert(data);
+	assert(bufsize>=limit);
+
+	sys_lock();
+	{
+		priv_seq_init(seq, limit, data, bufsize, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+seq_t *seq_create( unsigned limit, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	struct seq_T { seq_t seq; char buf[]; } *tmp;
+	seq_t *seq = NULL;
+	size_t bufsize;
+
+	assert_tsk_context();
+	assert(limit==seqSingle || limit==seqDouble);
+	assert(size);
+
+	sys_lock();
+	{
+		bufsize = limit * size;
+		tmp = malloc(sizeof(struct seq_T) + bufsize);
+		if (tmp)
+		{
+			memset(tmp->buf, 0, bufsize);
+			priv_seq_init(seq = &tmp->seq, limit, tmp->buf, bufsize, tmp);
+		}
+	}
+	sys_unlock();
+
+	return seq;
+}
+
+/* -------------------------------------------------------------------------- */
+void seq_destroy( seq_t *seq )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(seq);
+	assert(seq->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		core_res_free(&seq->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+/* single buffer: the counter is odd while the writer updates the data,        */
+/* the data is consistent if the counter is even and has not changed;          */
+/* double buffer: the writer updates the buffer ((count / 2) + 1) % 2,         */
+/* readers read the buffer (count / 2) % 2, which is updated again             */
+/* only when the counter exceeds (count & ~1) + 2                              */
+/* -------------------------------------------------------------------------- */
+
+/* -------------------------------------------------------------------------- */
+static
+const void *priv_seq_buffer( seq_t *seq, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	if (seq->limit == seqSingle)
+		return seq->data;
+
+	return &seq->data[((count >> 1) & 1) * seq->size];
+}
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_seq_valid( seq_t *seq, unsigned start, unsigned count )
+/* -------------------------------------------------------------------------- */
+{
+	if (seq->limit == seqSingle)
+		return count == start && (start & 1) == 0;
+
+	return count - (start & ~1U) <= 2;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned seq_readBegin( seq_t *seq, const void **data )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned start;
+
+	assert(seq);
+	assert(seq->obj.res!=RELEASED);
+	assert(data);
+
+	start = atomic_load_explicit((atomic_uint *)&seq->count, memory_order_acquire);
+	*data = priv_seq_buffer(seq, start);
+
+	return start;
+}
+
+/* -------------------------------------------------------------------------- */
+bool seq_readRetry( seq_t *seq, unsigned start )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(seq);
+	assert(seq->obj.res!=RELEASED);
+
+	atomic_thread_fence(memory_order_acquire);
+	count = atomic_load_explicit((atomic_uint *)&seq->count, memory_order_relaxed);
+
+	return !priv_seq_valid(seq, start, count);
+}
+
+/* -------------------------------------------------------------------------- */
+int seq_read( seq_t *seq, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	const void *buf;
+	unsigned start;
+
+	assert(seq);
+	assert(seq->obj.res!=RELEASED);
+	assert(data);
+
+	do
+	{
+		start = seq_readBegin(seq, &buf);
+		if (seq->limit == seqSingle && (start & 1) != 0)
+			return E_TIMEOUT;
+		memcpy(data, buf, seq->size);
+	}
+	while (seq_readRetry(seq, start));
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+void *seq_writeBegin( seq_t *seq )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(seq);
+	assert(seq->obj.res!=RELEASED);
+
+	count = atomic_load_explicit((atomic_uint *)&seq->count, memory_order_relaxed);
+	assert((count & 1) == 0);
+
+	atomic_store_explicit((atomic_uint *)&seq->count, count + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	return (void *) priv_seq_buffer(seq, count + 2);
+}
+
+/* -------------------------------------------------------------------------- */
+void seq_writeEnd( seq_t *seq )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(seq);
+	assert(seq->obj.res!=RELEASED);
+
+	count = atomic_load_explicit((atomic_uint *)&seq->count, memory_order_relaxed);
+	assert((count & 1) != 0);
+
+	atomic_store_explicit((atomic_uint *)&seq->count, count + 1, memory_order_release);
+}
+
+/* -------------------------------------------------------------------------- */
+void seq_write( seq_t *seq, const void *data )
+/* -------------------------------------------------------------------------- */
+{
+	assert(data);
+
+	memcpy(seq_writeBegin(seq), data, seq->size);
+	seq_writeEnd(seq);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_ATOMICS
@@ -69,7 +69,7 @@ sig_t *sig_create( unsigned mask )
 
 	sys_lock();
 	{
-		sig = malloc(sizeof(sig_t));
+		sig = core_obj_alloc(cacheSIG, sizeof(sig_t));
 		if (sig)
 			priv_sig_init(sig, mask, sig);
 	}
@@ -124,6 +124,8 @@ static
 int priv_sig_take( sig_t *sig, unsigned sigset, unsigned *signo )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcSigTake, sig, sigset);
+
 	sigset &= sig->sigset;
 	sigset &= -sigset;
 
@@ -240,6 +242,34 @@ void sig_give( sig_t *sig, unsigned signo )
 	sys_unlock();
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_sig_giveDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	sig_give(obj, (unsigned) arg);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+void sig_giveISR( sig_t *sig, unsigned signo )
+/* -------------------------------------------------------------------------- */
+{
+	assert(sig);
+	assert(sig->obj.res!=RELEASED);
+
+	core_srv_defer(priv_sig_giveDeferred, sig, signo);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
 /* -------------------------------------------------------------------------- */
 void sig_clear( sig_t *sig, unsigned signo )
 /* -------------------------------------------------------------------------- */
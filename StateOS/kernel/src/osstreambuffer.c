@@ -94,6 +94,8 @@ void priv_stm_reset( stm_t *stm, int event )
 	stm->head  = 0;
 	stm->tail  = 0;
 
+	core_set_remove(&stm->obj);
+
 	core_all_wakeup(stm->obj.queue, event);
 }
 
@@ -134,13 +136,15 @@ void priv_stm_get( stm_t *stm, char *data, size_t size )
 /* -------------------------------------------------------------------------- */
 {
 	size_t i = stm->head;
+	size_t n = stm->limit - i;
+
+	if (n > size) n = size;
+	memcpy(data, &stm->data[i], n);
+	memcpy(data + n, stm->data, size - n);
 
 	stm->count -= size;
-	while (size--)
-	{
-		*data++ = stm->data[i++];
-		if (i == stm->limit) i = 0;
-	}
+	i += size;
+	if (i >= stm->limit) i -= stm->limit;
 	stm->head = i;
 }
 
@@ -150,16 +154,28 @@ void priv_stm_put( stm_t *stm, const char *data, size_t size )
 /* -------------------------------------------------------------------------- */
 {
 	size_t i = stm->tail;
+	size_t n = stm->limit - i;
+
+	if (n > size) n = size;
+	memcpy(&stm->data[i], data, n);
+	memcpy(stm->data, data + n, size - n);
 
 	stm->count += size;
-	while (size--)
-	{
-		stm->data[i++] = *data++;
-		if (i == stm->limit) i = 0;
-	}
+	i += size;
+	if (i >= stm->limit) i -= stm->limit;
 	stm->tail = i;
 }
 
+/* -------------------------------------------------------------------------- */
+static
+void priv_stm_commit( stm_t *stm, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	stm->count += size;
+	stm->tail  += size;
+	if (stm->tail >= stm->limit) stm->tail -= stm->limit;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_stm_skip( stm_t *stm, size_t size )
@@ -172,36 +188,81 @@ void priv_stm_skip( stm_t *stm, size_t size )
 
 /* -------------------------------------------------------------------------- */
 static
-size_t priv_stm_getUpdate( stm_t *stm, char *data, size_t size )
+void priv_stm_getWakeup( stm_t *stm )
 /* -------------------------------------------------------------------------- */
 {
-	if (size > stm->count) size = stm->count;
-	priv_stm_get(stm, data, size);
-
-	while (stm->obj.queue != 0 && stm->count + stm->obj.queue->tmp.stm.size <= stm->limit)
+	while (stm->obj.queue != 0 && stm->obj.queue->tmp.stm.level == 0 && stm->count + stm->obj.queue->tmp.stm.size <= stm->limit)
 	{
 		priv_stm_put(stm, stm->obj.queue->tmp.stm.data.out, stm->obj.queue->tmp.stm.size);
 		core_one_wakeup(stm->obj.queue, E_SUCCESS);
 	}
+}
 
-	return size;
+/* -------------------------------------------------------------------------- */
+static
+void priv_stm_getTask( stm_t *stm, tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	size_t size = tsk->tmp.stm.size;
+
+	if (size > stm->count) size = stm->count;
+	tsk->tmp.stm.size = size;
+	priv_stm_get(stm, tsk->tmp.stm.data.in, size);
+	core_tsk_wakeup(tsk, E_SUCCESS);
 }
 
 /* -------------------------------------------------------------------------- */
 static
-void priv_stm_putUpdate( stm_t *stm, const char *data, size_t size )
+void priv_stm_putWakeup( stm_t *stm )
 /* -------------------------------------------------------------------------- */
 {
-	priv_stm_put(stm, data, size);
+	tsk_t *tsk = stm->obj.queue;
+	tsk_t *nxt;
 
-	while (stm->obj.queue != 0 && stm->count > 0)
+	while (tsk != 0 && tsk->tmp.stm.level > 0 && stm->count > 0)
 	{
-		size = stm->obj.queue->tmp.stm.size;
-		if (size > stm->count) size = stm->count;
-		stm->obj.queue->tmp.stm.size = size;
-		priv_stm_get(stm, stm->obj.queue->tmp.stm.data.in, size);
-		core_one_wakeup(stm->obj.queue, E_SUCCESS);
+		nxt = tsk->obj.queue;
+		if (stm->count >= tsk->tmp.stm.level)
+			priv_stm_getTask(stm, tsk);
+		else
+		//	trigger level not reached yet, restart the idle timeout of the receiving task
+			core_tsk_rewind(tsk);
+		tsk = nxt;
 	}
+
+	if (stm->count > 0)
+		core_set_notify(&stm->obj);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_stm_flush( stm_t *stm )
+/* -------------------------------------------------------------------------- */
+{
+//	deliver data to the receiving tasks regardless of their trigger levels
+	while (stm->obj.queue != 0 && stm->obj.queue->tmp.stm.level > 0 && stm->count > 0)
+		priv_stm_getTask(stm, stm->obj.queue);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+size_t priv_stm_getUpdate( stm_t *stm, char *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	if (size > stm->count) size = stm->count;
+	priv_stm_get(stm, data, size);
+	priv_stm_getWakeup(stm);
+
+	return size;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_stm_putUpdate( stm_t *stm, const char *data, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	priv_stm_put(stm, data, size);
+	priv_stm_putWakeup(stm);
 }
 
 /* -------------------------------------------------------------------------- */
@@ -209,7 +270,7 @@ static
 void priv_stm_skipUpdate( stm_t *stm, size_t size )
 /* -------------------------------------------------------------------------- */
 {
-	while (stm->obj.queue != 0)
+	while (stm->obj.queue != 0 && stm->obj.queue->tmp.stm.level == 0)
 	{
 		if (stm->count + stm->obj.queue->tmp.stm.size > stm->limit)
 			priv_stm_skip(stm, stm->count + stm->obj.queue->tmp.stm.size - stm->limit);
@@ -226,6 +287,8 @@ static
 int priv_stm_take( stm_t *stm, char *data, size_t size, size_t *read )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcStmTake, stm, size);
+
 	if (stm->count > 0)
 	{
 		size = priv_stm_getUpdate(stm, data, size);
@@ -280,6 +343,7 @@ int stm_waitFor( stm_t *stm, void *data, size_t size, size_t *read, cnt_t delay
 		{
 			System.cur->tmp.stm.data.in = data;
 			System.cur->tmp.stm.size = size;
+			System.cur->tmp.stm.level = 1;
 			result = core_tsk_waitFor(&stm->obj.queue, delay);
 			if (result == E_SUCCESS && read != NULL)
 				*read = System.cur->tmp.stm.size;
@@ -311,6 +375,7 @@ int stm_waitUntil( stm_t *stm, void *data, size_t size, size_t *read, cnt_t time
 		{
 			System.cur->tmp.stm.data.in = data;
 			System.cur->tmp.stm.size = size;
+			System.cur->tmp.stm.level = 1;
 			result = core_tsk_waitUntil(&stm->obj.queue, time);
 			if (result == E_SUCCESS && read != NULL)
 				*read = System.cur->tmp.stm.size;
@@ -321,11 +386,58 @@ int stm_waitUntil( stm_t *stm, void *data, size_t size, size_t *read, cnt_t time
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+int stm_waitLevel( stm_t *stm, void *data, size_t size, size_t *read, size_t level, cnt_t idle )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(stm);
+	assert(stm->obj.res!=RELEASED);
+	assert(stm->data);
+	assert(stm->limit);
+	assert(data);
+	assert(size);
+	assert(level);
+
+	if (level > size)
+		level = size;
+
+	sys_lock();
+	{
+		result = E_TIMEOUT;
+		if (stm->count >= level)
+			result = priv_stm_take(stm, data, size, read);
+		if (result == E_TIMEOUT)
+		{
+			System.cur->tmp.stm.data.in = data;
+			System.cur->tmp.stm.size = size;
+			System.cur->tmp.stm.level = level;
+			result = core_tsk_waitFor(&stm->obj.queue, idle);
+			if (result == E_SUCCESS && read != NULL)
+				*read = System.cur->tmp.stm.size;
+			else
+			if (result == E_TIMEOUT)
+			//	the idle timeout expired, receive the data available so far
+				result = priv_stm_take(stm, data, size, read);
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
 /* -------------------------------------------------------------------------- */
 static
 int priv_stm_give( stm_t *stm, const char *data, size_t size )
 /* -------------------------------------------------------------------------- */
 {
+	core_trc_put(trcStmGive, stm, size);
+
+	if (stm->count + size > stm->limit)
+		priv_stm_flush(stm);
+
 	if (stm->count + size <= stm->limit)
 	{
 		priv_stm_putUpdate(stm, data, size);
@@ -381,6 +493,7 @@ int stm_sendFor( stm_t *stm, const void *data, size_t size, cnt_t delay )
 		{
 			System.cur->tmp.stm.data.out = data;
 			System.cur->tmp.stm.size = size;
+			System.cur->tmp.stm.level = 0;
 			result = core_tsk_waitFor(&stm->obj.queue, delay);
 		}
 	}
@@ -410,6 +523,7 @@ int stm_sendUntil( stm_t *stm, const void *data, size_t size, cnt_t time )
 		{
 			System.cur->tmp.stm.data.out = data;
 			System.cur->tmp.stm.size = size;
+			System.cur->tmp.stm.level = 0;
 			result = core_tsk_waitUntil(&stm->obj.queue, time);
 		}
 	}
@@ -456,6 +570,107 @@ int stm_push( stm_t *stm, const void *data, size_t size )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+void *stm_reserve( stm_t *stm, size_t *size )
+/* -------------------------------------------------------------------------- */
+{
+	void *data = NULL;
+	size_t space = 0;
+
+	assert(stm);
+	assert(stm->obj.res!=RELEASED);
+	assert(stm->data);
+	assert(stm->limit);
+	assert(size);
+
+	sys_lock();
+	{
+		if (stm->obj.queue == 0 || stm->obj.queue->tmp.stm.level > 0)
+		{
+		//	there are no tasks waiting to send data, the free space can be reserved
+			space = stm->limit - stm->count;
+			if (space > stm->limit - stm->tail)
+				space = stm->limit - stm->tail;
+			if (space > 0)
+				data = &stm->data[stm->tail];
+		}
+	}
+	sys_unlock();
+
+	*size = space;
+	return data;
+}
+
+/* -------------------------------------------------------------------------- */
+void stm_commit( stm_t *stm, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	assert(stm);
+	assert(stm->obj.res!=RELEASED);
+	assert(stm->data);
+	assert(stm->limit);
+
+	sys_lock();
+	{
+		core_trc_put(trcStmGive, stm, size);
+
+		assert(size <= stm->limit - stm->count);
+		assert(size <= stm->limit - stm->tail);
+
+		priv_stm_commit(stm, size);
+		priv_stm_putWakeup(stm);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+const void *stm_peek( stm_t *stm, size_t *size )
+/* -------------------------------------------------------------------------- */
+{
+	const void *data = NULL;
+	size_t count;
+
+	assert(stm);
+	assert(stm->obj.res!=RELEASED);
+	assert(stm->data);
+	assert(stm->limit);
+	assert(size);
+
+	sys_lock();
+	{
+		count = stm->count;
+		if (count > stm->limit - stm->head)
+			count = stm->limit - stm->head;
+		if (count > 0)
+			data = &stm->data[stm->head];
+	}
+	sys_unlock();
+
+	*size = count;
+	return data;
+}
+
+/* -------------------------------------------------------------------------- */
+void stm_consume( stm_t *stm, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	assert(stm);
+	assert(stm->obj.res!=RELEASED);
+	assert(stm->data);
+	assert(stm->limit);
+
+	sys_lock();
+	{
+		core_trc_put(trcStmTake, stm, size);
+
+		assert(size <= stm->count);
+
+		priv_stm_skip(stm, size);
+		priv_stm_getWakeup(stm);
+	}
+	sys_unlock();
+}
+
 /* -------------------------------------------------------------------------- */
 size_t stm_count( stm_t *stm )
 /* -------------------------------------------------------------------------- */
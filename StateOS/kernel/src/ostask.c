@@ -61,7 +61,7 @@ tsk_t *priv_wrk_create( unsigned prio, fun_t *state, size_t size, bool detached
 	size_t bufsize;
 
 	bufsize = STK_OVER(size);
-	tmp = malloc(sizeof(struct tsk_T) + bufsize);
+	tmp = core_obj_alloc(cacheTSK, sizeof(struct tsk_T) + bufsize);
 	if (tmp)
 		priv_wrk_init(tsk = &tmp->tsk, prio, state, tmp->buf, bufsize, tmp, detached);
 
@@ -535,6 +535,34 @@ int tsk_resume( tsk_t *tsk )
 	return result;
 }
 
+/* -------------------------------------------------------------------------- */
+
+#if OS_DEFER_SIZE
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_tsk_resumeDeferred( void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	(void) arg;
+
+	return tsk_resume(obj);
+}
+
+/* -------------------------------------------------------------------------- */
+int tsk_resumeISR( tsk_t *tsk )
+/* -------------------------------------------------------------------------- */
+{
+	assert(tsk);
+	assert(tsk->obj.res!=RELEASED);
+
+	return core_srv_defer(priv_tsk_resumeDeferred, tsk, 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_DEFER_SIZE
+
 /* -------------------------------------------------------------------------- */
 static
 void priv_sig_handler( tsk_t *tsk )
@@ -650,3 +678,100 @@ void tsk_action( tsk_t *tsk, act_t *action )
 }
 
 /* -------------------------------------------------------------------------- */
+
+#if OS_TASK_STATS
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_tsk_getStats( tsk_t *tsk, sts_t *sts, uint32_t now, cnt_t tick )
+/* -------------------------------------------------------------------------- */
+{
+	sts->tsk    = tsk;
+	sts->cycles = tsk->sts.cycles;
+	sts->count  = tsk->sts.count;
+	sts->last   = tsk->sts.last;
+
+	if (tsk == System.cur)
+		sts->cycles += core_sts_delta(now, tick, tsk->sts.last, tsk->sts.time);
+}
+
+/* -------------------------------------------------------------------------- */
+void tsk_getStats( tsk_t *tsk, sts_t *sts )
+/* -------------------------------------------------------------------------- */
+{
+	assert(tsk);
+	assert(sts);
+
+	sys_lock();
+	{
+		priv_tsk_getStats(tsk, sts, core_sts_time(), core_sys_time());
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned tsk_getSnapshot( sts_t *tab, unsigned limit )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count = 0;
+	uint32_t now;
+	cnt_t    tick;
+	tsk_t  * tsk;
+	tmr_t  * tmr;
+
+	assert(tab);
+
+	sys_lock();
+	{
+		now  = core_sts_time();
+		tick = core_sys_time();
+
+		if (count < limit)
+			priv_tsk_getStats(&IDLE, &tab[count++], now, tick);
+		for (tsk = core_tsk_next(&IDLE); tsk != &IDLE && count < limit; tsk = core_tsk_next(tsk))
+			priv_tsk_getStats(tsk, &tab[count++], now, tick);
+		for (tmr = core_tmr_next(&WAIT); tmr != &WAIT && count < limit; tmr = core_tmr_next(tmr))
+			if (tmr->hdr.id == ID_READY)
+				priv_tsk_getStats((tsk_t *)tmr, &tab[count++], now, tick);
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned tsk_getLoad( void )
+/* -------------------------------------------------------------------------- */
+{
+	static uint32_t last = 0;
+	static cnt_t    time = 0;
+	static uint64_t idle = 0;
+
+	unsigned load = 0;
+	sts_t    sts;
+	uint32_t now;
+	cnt_t    tick;
+	uint64_t delta;
+
+	sys_lock();
+	{
+		now  = core_sts_time();
+		tick = core_sys_time();
+		priv_tsk_getStats(&IDLE, &sts, now, tick);
+
+		delta = core_sts_delta(now, tick, last, time);
+		if (sts.cycles - idle < delta)
+			load = 1000 - (unsigned)((sts.cycles - idle) * 1000 / delta);
+
+		last = now;
+		time = tick;
+		idle = sts.cycles;
+	}
+	sys_unlock();
+
+	return load;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_TASK_STATS
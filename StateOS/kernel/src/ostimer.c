@@ -69,7 +69,7 @@ tmr_t *tmr_create( fun_t *state )
 
 	sys_lock();
 	{
-		tmr = malloc(sizeof(tmr_t));
+		tmr = core_obj_alloc(cacheTMR, sizeof(tmr_t));
 		if (tmr)
 			priv_tmr_init(tmr, state, tmr);
 	}
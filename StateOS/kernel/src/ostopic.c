@@ -0,0 +1,755 @@
+/******************************************************************************
+
+    @file    StateOS: ostopic.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/ostopic.h"
+#include "inc/ostask.h"
+#include "inc/oscriticalsection.h"
+
+/* -------------------------------------------------------------------------- */
+static
+unsigned *priv_tpc_refs( void *data )
+/* -------------------------------------------------------------------------- */
+{
+	return (unsigned *)((que_t *) data - 1);
+}
+
+/* -------------------------------------------------------------------------- */
+void tpc_bind( tpc_t *tpc )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tpc);
+
+	mem_bind(&tpc->mem);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_tpc_init( tpc_t *tpc, size_t size, que_t *data, size_t bufsize, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(tpc, 0, sizeof(tpc_t));
+
+	core_obj_init(&tpc->obj, res);
+	core_obj_init(&tpc->mem.lst.obj, NULL);
+
+	tpc->mem.limit = bufsize / (1 + TPC_SIZE(size)) / sizeof(que_t);
+	tpc->mem.size  = TPC_SIZE(size);
+	tpc->mem.data  = data;
+
+	mem_bind(&tpc->mem);
+}
+
+/* -------------------------------------------------------------------------- */
+void tpc_init( tpc_t *tpc, size_t size, que_t *data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tpc);
+	assert(size);
+	assert(data);
+	assert(bufsize);
+
+	sys_lock();
+	{
+		priv_tpc_init(tpc, size, data, bufsize, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+tpc_t *tpc_create( unsigned limit, size_t size )
+/* -------------------------------------------------------------------------- */
+{
+	struct tpc_T { tpc_t tpc; que_t buf[]; } *tmp;
+	tpc_t *tpc = NULL;
+	size_t bufsize;
+
+	assert_tsk_context();
+	assert(limit);
+	assert(size);
+
+	sys_lock();
+	{
+		bufsize = limit * (1 + TPC_SIZE(size)) * sizeof(que_t);
+		tmp = malloc(sizeof(struct tpc_T) + bufsize);
+		if (tmp)
+			priv_tpc_init(tpc = &tmp->tpc, size, tmp->buf, bufsize, tmp);
+	}
+	sys_unlock();
+
+	return tpc;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_tpc_release( tpc_t *tpc, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned *refs = priv_tpc_refs(data);
+
+	assert(*refs > 0);
+
+	if (--*refs == 0)
+		mem_give(&tpc->mem, (que_t *) data - 1);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_sub_drop( sub_t *sub )
+/* -------------------------------------------------------------------------- */
+{
+	while (sub->count > 0)
+	{
+		priv_tpc_release(sub->tpc, sub->data[sub->head]);
+		if (++sub->head == sub->limit) sub->head = 0;
+		sub->count--;
+	}
+
+	sub->head = sub->tail = 0;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_sub_unlink( sub_t *sub )
+/* -------------------------------------------------------------------------- */
+{
+	tpc_t *tpc = sub->tpc;
+	sub_t **ptr = &tpc->subs;
+	tsk_t *tsk;
+
+	priv_sub_drop(sub);
+
+//	publishers blocked on this subscriber continue with the next one
+	for (tsk = tpc->obj.queue; tsk != NULL; tsk = tsk->obj.queue)
+		if (tsk->tmp.tpc.sub == sub)
+			tsk->tmp.tpc.sub = sub->next;
+
+	while (*ptr != sub)
+		ptr = &(*ptr)->next;
+	*ptr = sub->next;
+
+	sub->next = NULL;
+	sub->tpc  = NULL;
+
+//	publishers blocked on this subscriber have to check the next subscribers
+	core_all_wakeup(tpc->obj.queue, E_SUCCESS);
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_tpc_reset( tpc_t *tpc, int event )
+/* -------------------------------------------------------------------------- */
+{
+	core_all_wakeup(tpc->obj.queue, event);
+	core_all_wakeup(tpc->mem.lst.obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void tpc_reset( tpc_t *tpc )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tpc);
+	assert(tpc->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_tpc_reset(tpc, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void tpc_destroy( tpc_t *tpc )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(tpc);
+	assert(tpc->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		while (tpc->subs != NULL)
+			priv_sub_unlink(tpc->subs);
+		priv_tpc_reset(tpc, tpc->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&tpc->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+int tpc_loan( tpc_t *tpc, void **data )
+/* -------------------------------------------------------------------------- */
+{
+	void *blk;
+	int result;
+
+	assert(tpc);
+	assert(tpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		result = mem_take(&tpc->mem, &blk);
+		if (result == E_SUCCESS)
+		{
+			*(unsigned *) blk = 1;
+			*data = (que_t *) blk + 1;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int tpc_loanFor( tpc_t *tpc, void **data, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	void *blk;
+	int result;
+
+	assert_tsk_context();
+	assert(tpc);
+	assert(tpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		result = mem_waitFor(&tpc->mem, &blk, delay);
+		if (result == E_SUCCESS)
+		{
+			*(unsigned *) blk = 1;
+			*data = (que_t *) blk + 1;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int tpc_loanUntil( tpc_t *tpc, void **data, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	void *blk;
+	int result;
+
+	assert_tsk_context();
+	assert(tpc);
+	assert(tpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		result = mem_waitUntil(&tpc->mem, &blk, time);
+		if (result == E_SUCCESS)
+		{
+			*(unsigned *) blk = 1;
+			*data = (que_t *) blk + 1;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+bool priv_sub_put( sub_t *sub, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	tsk_t *tsk;
+
+	if (sub->count == 0 && (tsk = core_one_wakeup(sub->obj.queue, E_SUCCESS)) != NULL)
+	{
+		tsk->tmp.sub.data = data;
+	}
+	else
+	if (sub->count < sub->limit || sub->mode == subDropOldest)
+	{
+		if (sub->count == sub->limit)
+		{
+			priv_tpc_release(sub->tpc, sub->data[sub->head]);
+			if (++sub->head == sub->limit) sub->head = 0;
+			sub->count--;
+			sub->lost++;
+		}
+		sub->data[sub->tail] = data;
+		if (++sub->tail == sub->limit) sub->tail = 0;
+		sub->count++;
+	}
+	else
+	if (sub->mode == subDropNewest)
+	{
+		sub->lost++;
+		return true;
+	}
+	else
+	{
+		return false;
+	}
+
+	(*priv_tpc_refs(data))++;
+	return true;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_tpc_publish( tpc_t *tpc, void *data, int (*wait)( tsk_t **, cnt_t ), cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned seq = ++tpc->seq;
+	int result = E_SUCCESS;
+	sub_t *sub;
+
+//	subscribers that never block the publisher get the message at once
+	for (sub = tpc->subs; sub != NULL; sub = sub->next)
+		if (sub->mode != subBlock)
+			priv_sub_put(sub, data);
+
+//	the blocking subscribers are served in the list order,
+//	the blocked publisher resumes with the subscriber it waits for
+	sub = tpc->subs;
+	while (sub != NULL)
+	{
+	//	skip subscribers that subscribed after publication of the message
+		if (sub->mode == subBlock && (int)(sub->seq - seq) < 0 && !priv_sub_put(sub, data))
+		{
+			if (wait == NULL)
+			{
+				sub->lost++;
+				result = E_TIMEOUT;
+			}
+			else
+			{
+				System.cur->tmp.tpc.sub = sub;
+				result = wait(&tpc->obj.queue, time);
+				sub = System.cur->tmp.tpc.sub;
+				if (result != E_SUCCESS)
+					break;
+				continue;
+			}
+		}
+		sub = sub->next;
+	}
+
+//	the message is lost for the blocking subscribers not served before the timeout
+	for (; sub != NULL; sub = sub->next)
+		if (sub->mode == subBlock && (int)(sub->seq - seq) < 0)
+			sub->lost++;
+
+	priv_tpc_release(tpc, data);
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int tpc_publish( tpc_t *tpc, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(tpc);
+	assert(tpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_tpc_publish(tpc, data, NULL, 0);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int tpc_publishFor( tpc_t *tpc, void *data, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(tpc);
+	assert(tpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		if (delay == INFINITE)
+			result = priv_tpc_publish(tpc, data, core_tsk_waitFor, INFINITE);
+		else
+		if (delay == IMMEDIATE)
+			result = priv_tpc_publish(tpc, data, NULL, 0);
+		else
+		//	the publisher can be woken up many times, so the timeout is converted to the timepoint
+			result = priv_tpc_publish(tpc, data, core_tsk_waitUntil, core_sys_time() + delay);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int tpc_publishUntil( tpc_t *tpc, void *data, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(tpc);
+	assert(tpc->obj.res!=RELEASED);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_tpc_publish(tpc, data, core_tsk_waitUntil, time);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+void tpc_retain( tpc_t *tpc, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	assert(tpc);
+	assert(data);
+
+	(void) tpc;
+
+	sys_lock();
+	{
+		assert(*priv_tpc_refs(data) > 0);
+		(*priv_tpc_refs(data))++;
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void tpc_release( tpc_t *tpc, void *data )
+/* -------------------------------------------------------------------------- */
+{
+	assert(tpc);
+	assert(data);
+
+	sys_lock();
+	{
+		priv_tpc_release(tpc, data);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_sub_init( sub_t *sub, unsigned mode, void **data, size_t bufsize, void *res )
+/* -------------------------------------------------------------------------- */
+{
+	memset(sub, 0, sizeof(sub_t));
+
+	core_obj_init(&sub->obj, res);
+
+	sub->mode  = mode;
+	sub->limit = bufsize / sizeof(void *);
+	sub->data  = data;
+}
+
+/* -------------------------------------------------------------------------- */
+void sub_init( sub_t *sub, unsigned mode, void **data, size_t bufsize )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(sub);
+	assert(mode<=subBlock);
+	assert(data);
+	assert(bufsize>=sizeof(void *));
+
+	sys_lock();
+	{
+		priv_sub_init(sub, mode, data, bufsize, NULL);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+sub_t *sub_create( unsigned limit, unsigned mode )
+/* -------------------------------------------------------------------------- */
+{
+	struct sub_T { sub_t sub; void *buf[]; } *tmp;
+	sub_t *sub = NULL;
+	size_t bufsize;
+
+	assert_tsk_context();
+	assert(limit);
+	assert(mode<=subBlock);
+
+	sys_lock();
+	{
+		bufsize = limit * sizeof(void *);
+		tmp = malloc(sizeof(struct sub_T) + bufsize);
+		if (tmp)
+			priv_sub_init(sub = &tmp->sub, mode, tmp->buf, bufsize, tmp);
+	}
+	sys_unlock();
+
+	return sub;
+}
+
+/* -------------------------------------------------------------------------- */
+static
+void priv_sub_reset( sub_t *sub, int event )
+/* -------------------------------------------------------------------------- */
+{
+	if (sub->tpc != NULL)
+	{
+		priv_sub_drop(sub);
+		if (sub->mode == subBlock)
+			core_all_wakeup(sub->tpc->obj.queue, E_SUCCESS);
+	}
+
+	sub->lost = 0;
+
+	core_all_wakeup(sub->obj.queue, event);
+}
+
+/* -------------------------------------------------------------------------- */
+void sub_reset( sub_t *sub )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(sub);
+	assert(sub->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		priv_sub_reset(sub, E_STOPPED);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+void sub_destroy( sub_t *sub )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(sub);
+	assert(sub->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (sub->tpc != NULL)
+			priv_sub_unlink(sub);
+		priv_sub_reset(sub, sub->obj.res ? E_DELETED : E_STOPPED);
+		core_res_free(&sub->obj);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+int sub_subscribe( sub_t *sub, tpc_t *tpc )
+/* -------------------------------------------------------------------------- */
+{
+	int result = E_FAILURE;
+
+	assert_tsk_context();
+	assert(sub);
+	assert(sub->obj.res!=RELEASED);
+	assert(sub->data);
+	assert(sub->limit);
+	assert(tpc);
+	assert(tpc->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (sub->tpc == NULL)
+		{
+			sub->tpc  = tpc;
+			sub->seq  = tpc->seq;
+			sub->next = tpc->subs;
+			tpc->subs = sub;
+			result = E_SUCCESS;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+void sub_unsubscribe( sub_t *sub )
+/* -------------------------------------------------------------------------- */
+{
+	assert_tsk_context();
+	assert(sub);
+	assert(sub->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		if (sub->tpc != NULL)
+			priv_sub_unlink(sub);
+	}
+	sys_unlock();
+}
+
+/* -------------------------------------------------------------------------- */
+static
+int priv_sub_take( sub_t *sub, void **data )
+/* -------------------------------------------------------------------------- */
+{
+	if (sub->count == 0)
+		return E_TIMEOUT;
+
+	*data = sub->data[sub->head];
+	if (++sub->head == sub->limit) sub->head = 0;
+
+//	publishers may wait for space in the full subscriber queue
+	if (sub->count-- == sub->limit && sub->mode == subBlock)
+		core_all_wakeup(sub->tpc->obj.queue, E_SUCCESS);
+
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
+int sub_take( sub_t *sub, void **data )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert(sub);
+	assert(sub->obj.res!=RELEASED);
+	assert(sub->data);
+	assert(sub->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_sub_take(sub, data);
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int sub_waitFor( sub_t *sub, void **data, cnt_t delay )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(sub);
+	assert(sub->obj.res!=RELEASED);
+	assert(sub->data);
+	assert(sub->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_sub_take(sub, data);
+		if (result == E_TIMEOUT)
+		{
+			result = core_tsk_waitFor(&sub->obj.queue, delay);
+			if (result == E_SUCCESS)
+				*data = System.cur->tmp.sub.data;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+int sub_waitUntil( sub_t *sub, void **data, cnt_t time )
+/* -------------------------------------------------------------------------- */
+{
+	int result;
+
+	assert_tsk_context();
+	assert(sub);
+	assert(sub->obj.res!=RELEASED);
+	assert(sub->data);
+	assert(sub->limit);
+	assert(data);
+
+	sys_lock();
+	{
+		result = priv_sub_take(sub, data);
+		if (result == E_TIMEOUT)
+		{
+			result = core_tsk_waitUntil(&sub->obj.queue, time);
+			if (result == E_SUCCESS)
+				*data = System.cur->tmp.sub.data;
+		}
+	}
+	sys_unlock();
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sub_count( sub_t *sub )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned count;
+
+	assert(sub);
+	assert(sub->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		count = sub->count;
+	}
+	sys_unlock();
+
+	return count;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned sub_lost( sub_t *sub )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned lost;
+
+	assert(sub);
+	assert(sub->obj.res!=RELEASED);
+
+	sys_lock();
+	{
+		lost = sub->lost;
+	}
+	sys_unlock();
+
+	return lost;
+}
+
+/* -------------------------------------------------------------------------- */
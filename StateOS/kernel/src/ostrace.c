@@ -0,0 +1,100 @@
+/******************************************************************************
+
+    @file    StateOS: ostrace.c
+    @author  Rajmund Szymanski
+    @date    13.05.2020
+    @brief   This file provides set of functions for StateOS.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "inc/ostrace.h"
+
+#if OS_TRACE_SIZE
+
+/* -------------------------------------------------------------------------- */
+
+static  struct
+{
+	volatile
+	unsigned head;          // number of records put to the buffer
+	volatile
+	unsigned tail;          // number of records read from the buffer
+	unsigned lost;          // number of lost records
+	trc_t    rec[OS_TRACE_SIZE];
+}	Trace;
+
+/* -------------------------------------------------------------------------- */
+void core_trc_put( unsigned code, const void *obj, uintptr_t arg )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned head = Trace.head;
+	trc_t  * rec;
+
+	if (head - Trace.tail >= OS_TRACE_SIZE)
+	{
+		Trace.lost++;
+		return;
+	}
+
+	rec = &Trace.rec[head % OS_TRACE_SIZE];
+	rec->time = core_sts_time();
+	rec->code = (uint16_t)code;
+	rec->seq  = (uint16_t)(head + Trace.lost);
+	rec->obj  = (uint32_t)(uintptr_t)obj;
+	rec->arg  = (uint32_t)arg;
+
+	__DMB();
+	Trace.head = head + 1;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned trc_read( trc_t *tab, unsigned limit )
+/* -------------------------------------------------------------------------- */
+{
+	unsigned tail = Trace.tail;
+	unsigned head = Trace.head;
+	unsigned cnt;
+
+	assert(tab);
+
+	__DMB();
+	for (cnt = 0; cnt < limit && tail != head; cnt++)
+		tab[cnt] = Trace.rec[tail++ % OS_TRACE_SIZE];
+	__DMB();
+	Trace.tail = tail;
+
+	return cnt;
+}
+
+/* -------------------------------------------------------------------------- */
+unsigned trc_lost( void )
+/* -------------------------------------------------------------------------- */
+{
+	return Trace.lost;
+}
+
+/* -------------------------------------------------------------------------- */
+
+#endif//OS_TRACE_SIZE
@@ -143,6 +143,20 @@ void port_sys_init( void )
 /******************************************************************************
  End of configuration
 *******************************************************************************/
+
+	#if OS_TASK_STATS || OS_TRACE_SIZE
+
+/******************************************************************************
+ Configuration of cycle counter for tasks statistics and kernel trace
+*******************************************************************************/
+
+	port_sts_init();
+
+/******************************************************************************
+ End of configuration
+*******************************************************************************/
+
+	#endif//OS_TASK_STATS || OS_TRACE_SIZE
 }
 
 /* -------------------------------------------------------------------------- */
@@ -37,6 +37,7 @@
 #include "osconfig.h"
 #endif
 #include "osdefs.h"
+#include "oscommon.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -126,6 +127,32 @@ void port_ctx_reset( void )
 #endif
 }
 
+/* -------------------------------------------------------------------------- */
+// stop the system timer (non-tick-less mode)
+
+#if HW_TIMER_SIZE == 0
+
+__STATIC_INLINE
+void port_sys_suspend( void )
+{
+	SysTick->CTRL = SysTick->CTRL & ~SysTick_CTRL_ENABLE_Msk;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// restart the system timer (non-tick-less mode)
+
+#if HW_TIMER_SIZE == 0
+
+__STATIC_INLINE
+void port_sys_resume( void )
+{
+	SysTick->CTRL = SysTick->CTRL |  SysTick_CTRL_ENABLE_Msk;
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // clear time breakpoint
 
@@ -0,0 +1,113 @@
+/******************************************************************************
+
+    @file    StateOS: oscommon.c
+    @author  Rajmund Szymanski
+    @date    17.10.2026
+    @brief   StateOS port file common for Cortex-M uC.
+
+ ******************************************************************************
+
+   Copyright (c) 2018-2020 Rajmund Szymanski. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+   furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included
+   in all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+   OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+   THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+   LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+
+ ******************************************************************************/
+
+#include "oskernel.h"
+
+/* -------------------------------------------------------------------------- */
+
+#if HW_TIMER_SIZE == 0 && OS_TICK_SUPPRESS
+
+/******************************************************************************
+ Non-tick-less mode: suppression of system timer interrupts in the idle task
+*******************************************************************************/
+
+cnt_t port_sys_sleep( cnt_t delay )
+{
+	uint32_t ctrl   = SysTick->CTRL & ~SysTick_CTRL_COUNTFLAG_Msk;
+	uint32_t period = SysTick->LOAD + 1U;
+	uint32_t limit  = (SysTick_LOAD_RELOAD_Msk + 1U) / period;
+	uint32_t load;
+	uint32_t time;
+	cnt_t    cnt;
+
+	if (delay > limit)
+		delay = limit;
+
+	SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+	if (delay < 2 || (ctrl & SysTick_CTRL_ENABLE_Msk) == 0 || (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk))
+	{
+		SysTick->CTRL = ctrl;
+		__WFI();
+		return 0;
+	}
+
+	time = period - SysTick->VAL;          // elapsed time of the current tick
+	load = (uint32_t)delay * period - time; // time to the next event of the timers queue
+
+	SysTick->LOAD = load - 1U;
+	SysTick->VAL  = 0U;
+	SysTick->CTRL = ctrl;
+
+	#if OS_TICK_SUPPRESS > 1
+	SCB->SCR |=  SCB_SCR_SLEEPDEEP_Msk;
+	#endif
+	__DSB();
+	__WFI();
+	__ISB();
+	#if OS_TICK_SUPPRESS > 1
+	SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+	#endif
+
+	SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+
+	if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk)
+	{
+	//	the whole delay has elapsed, the last tick will be counted by the interrupt handler
+		cnt  = delay - 1;
+		time = load - 1U - SysTick->VAL;
+	}
+	else
+	{
+	//	woken up by another interrupt
+		time = time + load - 1U - SysTick->VAL;
+		cnt  = time / period;
+		time = time % period;
+	}
+
+	if (time > period - 2U)
+		time = period - 2U;
+
+	SysTick->LOAD = period - time - 1U;
+	SysTick->VAL  = 0U;
+	SysTick->CTRL = ctrl;
+	SysTick->LOAD = period - 1U;
+
+	return cnt;
+}
+
+/******************************************************************************
+ End of the function
+*******************************************************************************/
+
+#endif//HW_TIMER_SIZE == 0 && OS_TICK_SUPPRESS
+
+/* -------------------------------------------------------------------------- */
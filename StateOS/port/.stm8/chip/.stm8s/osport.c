@@ -31,6 +31,10 @@
 
 #include "oskernel.h"
 
+#if HW_TIMER_SIZE == 0 && OS_TICK_SUPPRESS
+#error  OS_TICK_SUPPRESS is not supported by this port!
+#endif
+
 /* -------------------------------------------------------------------------- */
 
 void port_sys_init( void )
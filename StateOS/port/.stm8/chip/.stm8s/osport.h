@@ -122,6 +122,32 @@ void port_ctx_reset( void )
 #endif
 }
 
+/* -------------------------------------------------------------------------- */
+// stop the system timer (non-tick-less mode)
+
+#if HW_TIMER_SIZE == 0
+
+__STATIC_INLINE
+void port_sys_suspend( void )
+{
+	TIM3->CR1 = TIM3->CR1 & ~TIM3_CR1_CEN;
+}
+
+#endif
+
+/* -------------------------------------------------------------------------- */
+// restart the system timer (non-tick-less mode)
+
+#if HW_TIMER_SIZE == 0
+
+__STATIC_INLINE
+void port_sys_resume( void )
+{
+	TIM3->CR1 = TIM3->CR1 |  TIM3_CR1_CEN;
+}
+
+#endif
+
 /* -------------------------------------------------------------------------- */
 // clear time breakpoint
 
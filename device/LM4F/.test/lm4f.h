@@ -0,0 +1,142 @@
+/******************************************************************************
+ * @file    lm4f.h
+ * @author  Rajmund Szymanski
+ * @date    17.10.2026
+ * @brief   This file contains mock registers of the LM4F devices for the host test of the UART driver.
+ ******************************************************************************/
+
+#pragma once
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+
+/* -------------------------------------------------------------------------- */
+
+#ifndef CPU_FREQUENCY
+#define CPU_FREQUENCY 80000000 /* Hz */
+#endif
+
+#define __ALIGNED(x) __attribute__((aligned(x)))
+
+/* Receive FIFO of the UART ------------------------------------------------- */
+
+struct MOCK_FIFO
+{
+	uint8_t  data[16];
+	unsigned head;
+	unsigned count;
+};
+
+extern MOCK_FIFO RX_FIFO;
+
+// reading the data register pops the receive FIFO
+struct MOCK_DR
+{
+	operator uint32_t() const volatile
+	{
+		uint32_t c = 0;
+		if (RX_FIFO.count > 0)
+		{
+			c = RX_FIFO.data[RX_FIFO.head];
+			RX_FIFO.head = (RX_FIFO.head + 1) % sizeof(RX_FIFO.data);
+			RX_FIFO.count--;
+		}
+		return c;
+	}
+};
+
+// the flag register reflects the state of the receive FIFO
+struct MOCK_FR
+{
+	operator uint32_t() const volatile { return RX_FIFO.count == 0 ? 0x10U /* UART_FR_RXFE */ : 0U; }
+};
+
+// interrupt status register, writing ones clears the bits
+struct MOCK_IS
+{
+	uint32_t value;
+	operator uint32_t() const volatile { return value; }
+	void operator=( uint32_t v ) volatile { value &= ~v; }
+};
+
+// interrupt clear register, writing ones clears the bits of the masked interrupt status
+struct MOCK_ICR
+{
+	void operator=( uint32_t v ) volatile;
+};
+
+/* UART0 -------------------------------------------------------------------- */
+
+struct UART0_Type
+{
+	MOCK_DR  DR;
+	MOCK_FR  FR;
+	uint32_t IBRD;
+	uint32_t FBRD;
+	uint32_t LCRH;
+	uint32_t CTL;
+	uint32_t IFLS;
+	uint32_t IM;
+	uint32_t DMACTL;
+	MOCK_IS  MIS;   // masked interrupt status, set by the test
+	MOCK_ICR ICR;
+};
+
+extern volatile UART0_Type UART0_Mock;
+#define UART0 (&UART0_Mock)
+
+inline
+void MOCK_ICR::operator=( uint32_t v ) volatile { UART0_Mock.MIS.value &= ~v; }
+
+/* uDMA --------------------------------------------------------------------- */
+
+struct UDMA_Type
+{
+	uint32_t CFG;
+	uint32_t CTLBASE;
+	uint32_t CHMAP1;
+	uint32_t ENASET;      // enabled channels, the test clears the bit of the completed channel
+	uint32_t REQMASKSET;  // last value written
+	uint32_t REQMASKCLR;  // last value written
+	uint32_t USEBURSTSET; // last value written
+	uint32_t ALTCLR;      // last value written
+	MOCK_IS  CHIS;        // channel interrupt status, set by the test
+};
+
+extern volatile UDMA_Type UDMA_Mock;
+#define UDMA (&UDMA_Mock)
+
+/* System control, GPIO and NVIC -------------------------------------------- */
+
+struct SYSCTL_Type
+{
+	uint32_t RCGCGPIO;
+	uint32_t RCGCUART;
+	uint32_t RCGCDMA;
+};
+
+struct GPIOA_Type
+{
+	uint32_t AFSEL;
+	uint32_t PCTL;
+	uint32_t DEN;
+};
+
+extern volatile SYSCTL_Type SYSCTL_Mock;
+extern volatile GPIOA_Type  GPIOA_Mock;
+#define SYSCTL (&SYSCTL_Mock)
+#define GPIOA  (&GPIOA_Mock)
+
+extern volatile unsigned BITBAND_Mock[32];
+#define BITBAND(var) (BITBAND_Mock)
+
+enum { UART0_IRQn = 5 };
+
+static inline
+void NVIC_EnableIRQ( int irq ) { (void) irq; }
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,130 @@
+/******************************************************************************
+ * @file    os.h
+ * @author  Rajmund Szymanski
+ * @date    17.10.2026
+ * @brief   This file contains a mock of the StateOS stream buffer for the host test of the UART driver.
+ ******************************************************************************/
+
+#pragma once
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+
+/* -------------------------------------------------------------------------- */
+
+typedef uint32_t cnt_t;
+
+enum
+{
+	E_SUCCESS = 0,
+	E_FAILURE,
+	E_STOPPED,
+	E_DELETED,
+	E_TIMEOUT,
+};
+
+#define IMMEDIATE ((cnt_t)0)
+#define INFINITE  ((cnt_t)-1)
+
+static inline void sys_lock     ( void ) {}
+static inline void sys_unlock   ( void ) {}
+static inline void sys_lockISR  ( void ) {}
+static inline void sys_unlockISR( void ) {}
+
+/* Stream buffer ------------------------------------------------------------ */
+
+typedef struct
+{
+	char * data;  // storage
+	size_t limit; // size of the storage
+	size_t head;  // first byte of data
+	size_t tail;  // first free byte
+	size_t count; // number of bytes of data
+}	stm_t;
+
+static inline
+void stm_init( stm_t *stm, void *data, size_t limit )
+{
+	stm->data  = (char *) data;
+	stm->limit = limit;
+	stm->head  = 0;
+	stm->tail  = 0;
+	stm->count = 0;
+}
+
+static inline
+void *stm_reserveISR( stm_t *stm, size_t *size )
+{
+	if (stm->count == stm->limit)
+		return NULL;
+	*size = stm->tail < stm->head ? stm->head - stm->tail : stm->limit - stm->tail;
+	return &stm->data[stm->tail];
+}
+
+static inline
+void stm_commitISR( stm_t *stm, size_t size )
+{
+	assert(size <= stm->limit - stm->count);
+	stm->tail = (stm->tail + size) % stm->limit;
+	stm->count += size;
+}
+
+static inline
+const void *stm_peekISR( stm_t *stm, size_t *size )
+{
+	if (stm->count == 0)
+		return NULL;
+	*size = stm->head < stm->tail ? stm->tail - stm->head : stm->limit - stm->head;
+	return &stm->data[stm->head];
+}
+
+static inline
+void stm_consumeISR( stm_t *stm, size_t size )
+{
+	assert(size <= stm->count);
+	stm->head = (stm->head + size) % stm->limit;
+	stm->count -= size;
+}
+
+// the mock never waits
+static inline
+int stm_sendFor( stm_t *stm, const void *data, size_t size, cnt_t delay )
+{
+	const char *p = (const char *) data;
+
+	(void) delay;
+	if (size > stm->limit)
+		return E_FAILURE;
+	if (size > stm->limit - stm->count)
+		return E_TIMEOUT;
+	while (size--)
+	{
+		stm->data[stm->tail] = *p++;
+		stm_commitISR(stm, 1);
+	}
+	return E_SUCCESS;
+}
+
+static inline
+int stm_waitFor( stm_t *stm, void *data, size_t size, size_t *read, cnt_t delay )
+{
+	char *p = (char *) data;
+
+	(void) delay;
+	if (stm->count == 0)
+		return E_TIMEOUT;
+	*read = 0;
+	while (size-- > 0 && stm->count > 0)
+	{
+		*p++ = stm->data[stm->head];
+		stm_consumeISR(stm, 1);
+		(*read)++;
+	}
+	return E_SUCCESS;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,293 @@
+/******************************************************************************
+ * @file    uart_test.cpp
+ * @author  Rajmund Szymanski
+ * @date    17.10.2026
+ * @brief   Host test of the uDMA driven UART driver for EK-LM4F120XL Kit.
+ *          The UART0 and uDMA registers are mocked (lm4f.h), the stream buffers too (os.h).
+ ******************************************************************************/
+
+#undef  NDEBUG
+#include <stdio.h>
+#include <initializer_list>
+#include "../lm4f_120xl_uart.c"
+
+/* Mock registers ----------------------------------------------------------- */
+
+MOCK_FIFO            RX_FIFO;
+volatile UART0_Type  UART0_Mock;
+volatile UDMA_Type   UDMA_Mock;
+volatile SYSCTL_Type SYSCTL_Mock;
+volatile GPIOA_Type  GPIOA_Mock;
+volatile unsigned    BITBAND_Mock[32];
+
+/* Model of the hardware ---------------------------------------------------- */
+
+static unsigned hw_alt;            // control structure of the RX channel in use
+static char     hw_tx[4096];       // data sent on the TX line
+static size_t   hw_tx_count;
+
+static
+uint32_t hw_mode( dma_t *ch )
+{
+	return ch->ctl & UDMA_CHCTL_XFERMODE_M;
+}
+
+static
+uint32_t hw_size( dma_t *ch )
+{
+	return (ch->ctl & UDMA_CHCTL_XFERSIZE_M) >> UDMA_CHCTL_XFERSIZE_S;
+}
+
+// the uDMA serves only burst requests of the RX channel (8 bytes in the FIFO)
+// the completed control structure raises the channel interrupt and the other one takes over
+static
+void hw_rx_run( bool irq )
+{
+	while (RX_FIFO.count >= 8)
+	{
+		dma_t *ch = &DMA[RX_CH + hw_alt * ALT];
+		if (hw_mode(ch) == UDMA_CHCTL_XFERMODE_STOP)
+			break;
+		assert(hw_mode(ch) == UDMA_CHCTL_XFERMODE_PINGPONG);
+		for (int i = 0; i < 8; i++)
+		{
+			uint32_t size = hw_size(ch);
+			*((volatile char *) ch->dst - size) = (char) UART0->DR;
+			if (size > 0)
+				ch->ctl = (ch->ctl & ~UDMA_CHCTL_XFERSIZE_M) | ((size - 1) << UDMA_CHCTL_XFERSIZE_S);
+			else
+				ch->ctl = (ch->ctl & ~UDMA_CHCTL_XFERMODE_M) | UDMA_CHCTL_XFERMODE_STOP;
+		}
+		if (hw_mode(ch) == UDMA_CHCTL_XFERMODE_STOP)
+		{
+			UDMA_Mock.CHIS.value |= 1U << RX_CH;
+			hw_alt ^= 1;
+			if (irq)
+				UART_Handler();
+		}
+	}
+}
+
+// bytes arriving on the RX line, the FIFO never overflows
+static
+void hw_rx_line( const char *data, size_t size, bool irq )
+{
+	while (size > 0)
+	{
+		while (size > 0 && RX_FIFO.count < sizeof(RX_FIFO.data))
+		{
+			RX_FIFO.data[(RX_FIFO.head + RX_FIFO.count++) % sizeof(RX_FIFO.data)] = (uint8_t) *data++;
+			size--;
+		}
+		hw_rx_run(irq);
+	}
+}
+
+// the line is idle for 32 bit periods
+static
+void hw_rx_timeout( void )
+{
+	UART0_Mock.MIS.value |= UART_IM_RTIM;
+	UART_Handler();
+	assert((UART0_Mock.MIS.value & UART_IM_RTIM) == 0);
+}
+
+// the uDMA transfers the whole block of the TX channel and raises the channel interrupt
+static
+void hw_tx_run( void )
+{
+	while (UDMA_Mock.ENASET & (1U << TX_CH))
+	{
+		dma_t *ch = &DMA[TX_CH];
+		assert(hw_mode(ch) == UDMA_CHCTL_XFERMODE_BASIC);
+		assert(ch->dst == &UART0->DR);
+		size_t size = hw_size(ch) + 1;
+		assert(size <= 1024); // max number of items of a single uDMA transfer
+		assert(hw_tx_count + size <= sizeof(hw_tx));
+		memcpy(&hw_tx[hw_tx_count], (const char *) ch->src - (size - 1), size);
+		hw_tx_count += size;
+		ch->ctl = (ch->ctl & ~(UDMA_CHCTL_XFERMODE_M | UDMA_CHCTL_XFERSIZE_M)) | UDMA_CHCTL_XFERMODE_STOP;
+		UDMA_Mock.ENASET &= ~(1U << TX_CH);
+		UDMA_Mock.CHIS.value |= 1U << TX_CH;
+		UART_Handler();
+		assert((UDMA_Mock.CHIS.value & (1U << TX_CH)) == 0);
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static char   rx_buf[256];
+static char   tx_buf[2048];
+static stm_t  rx;
+static stm_t  tx;
+
+static char   pattern[4096];
+static size_t sent; // index of the next byte of the pattern on the RX line
+static size_t recv; // index of the next byte of the pattern expected from the stream buffer
+
+static
+void rx_send( size_t size, bool irq = true )
+{
+	assert(sent + size <= sizeof(pattern));
+	hw_rx_line(&pattern[sent], size, irq);
+	sent += size;
+}
+
+static
+void rx_check( size_t size )
+{
+	char   buf[sizeof(rx_buf)];
+	size_t read = 0;
+
+	assert(size <= sizeof(buf));
+	if (size > 0)
+	{
+		assert(UART_Read(buf, sizeof(buf), &read, IMMEDIATE) == E_SUCCESS);
+		assert(read == size);
+		assert(memcmp(buf, &pattern[recv], size) == 0);
+		recv += size;
+	}
+	assert(UART_Read(buf, sizeof(buf), &read, IMMEDIATE) == E_TIMEOUT);
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void test_init( void )
+{
+	stm_init(&rx, rx_buf, sizeof(rx_buf));
+	stm_init(&tx, tx_buf, sizeof(tx_buf));
+
+	UART_Init(115200, &rx, &tx);
+	hw_alt = 0;
+
+	assert(UDMA_Mock.CTLBASE == (uint32_t)(uintptr_t) DMA);
+	assert(UDMA_Mock.ENASET == (1U << RX_CH));
+	for (unsigned half = 0; half < 2; half++)
+	{
+		dma_t *ch = &DMA[RX_CH + half * ALT];
+		assert(hw_mode(ch) == UDMA_CHCTL_XFERMODE_PINGPONG);
+		assert(hw_size(ch) == UART_DMA_CHUNK - 1);
+		assert(ch->src == &UART0->DR);
+		assert(ch->dst == &UART.buf[half][UART_DMA_CHUNK - 1]);
+	}
+}
+
+// each completed half is committed by its own channel interrupt
+static
+void test_ping_pong( void )
+{
+	rx_send(UART_DMA_CHUNK);
+	assert(UART.half == 1);
+	rx_check(UART_DMA_CHUNK);
+
+	rx_send(UART_DMA_CHUNK);
+	assert(UART.half == 0);
+	rx_check(UART_DMA_CHUNK);
+	assert(UART_Lost() == 0);
+}
+
+// both halves completed before the channel interrupt is served
+static
+void test_ping_pong_late( void )
+{
+	rx_send(2 * UART_DMA_CHUNK, false);
+	assert(UART.half == 0);
+	rx_check(0);
+
+	UART_Handler();
+	assert(UART.half == 0);
+	assert(hw_mode(&DMA[RX_CH]) == UDMA_CHCTL_XFERMODE_PINGPONG);
+	assert(hw_mode(&DMA[RX_CH + ALT]) == UDMA_CHCTL_XFERMODE_PINGPONG);
+	rx_check(2 * UART_DMA_CHUNK);
+	assert(UART_Lost() == 0);
+}
+
+// the receive time-out commits the filled part of the active half and the tail of data from the FIFO
+static
+void test_rx_timeout( void )
+{
+	rx_send(UART_DMA_CHUNK / 2 + 5);
+	assert(RX_FIFO.count == 5);
+	rx_check(0);
+
+	hw_rx_timeout();
+	assert(RX_FIFO.count == 0);
+	assert(UDMA_Mock.REQMASKSET == (1U << RX_CH));
+	assert(UDMA_Mock.REQMASKCLR == (1U << RX_CH));
+	assert(UART.done == UART_DMA_CHUNK / 2);
+	rx_check(UART_DMA_CHUNK / 2 + 5);
+
+	// the half started before the time-out, the committed part is not repeated
+	rx_send(UART_DMA_CHUNK / 2);
+	assert(UART.half == 1);
+	assert(UART.done == 0);
+	rx_check(UART_DMA_CHUNK / 2);
+
+	rx_send(UART_DMA_CHUNK / 2 + 3);
+	hw_rx_timeout();
+	rx_check(UART_DMA_CHUNK / 2 + 3);
+	assert(UART_Lost() == 0);
+}
+
+// received data over the free space of the stream buffer is lost
+static
+void test_rx_lost( void )
+{
+	rx_send(sizeof(rx_buf) + 3 * UART_DMA_CHUNK / 2 - 2);
+	hw_rx_timeout();
+	assert(UART_Lost() == 3 * UART_DMA_CHUNK / 2 - 2);
+	rx_check(sizeof(rx_buf));
+	recv = sent;
+
+	rx_send(UART_DMA_CHUNK / 2);
+	hw_rx_timeout();
+	rx_check(UART_DMA_CHUNK / 2);
+	assert(UART_Lost() == 3 * UART_DMA_CHUNK / 2 - 2);
+}
+
+// the transmission is split at the end of the stream buffer and at the limit of a single uDMA transfer
+static
+void test_tx_drain( void )
+{
+	size_t size = 0;
+
+	for (size_t n : { 100, 1500, 1500, 7 })
+	{
+		assert(UART_Write(&pattern[size], n, IMMEDIATE) == E_SUCCESS);
+		hw_tx_run();
+		size += n;
+		assert(hw_tx_count == size);
+		assert(tx.count == 0);
+		assert(UART.busy == 0);
+	}
+	assert(memcmp(hw_tx, pattern, size) == 0);
+
+	// the stream buffer is full; the data is sent when the uDMA drains it
+	assert(UART_Write(pattern, sizeof(tx_buf), IMMEDIATE) == E_SUCCESS);
+	assert(UART_Write(pattern, 1, IMMEDIATE) == E_TIMEOUT);
+	hw_tx_count = 0;
+	hw_tx_run();
+	assert(hw_tx_count == sizeof(tx_buf));
+	assert(memcmp(hw_tx, pattern, sizeof(tx_buf)) == 0);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int main( void )
+{
+	for (size_t i = 0; i < sizeof(pattern); i++)
+		pattern[i] = (char)(i * 7 + i / 251);
+
+	test_init();
+	test_ping_pong();
+	test_ping_pong_late();
+	test_rx_timeout();
+	test_rx_lost();
+	test_tx_drain();
+
+	printf("ok\n");
+	return 0;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,273 @@
+/******************************************************************************
+ * @file    lm4f_120xl_uart.c
+ * @author  Rajmund Szymanski
+ * @date    17.10.2026
+ * @brief   This file contains uDMA driven UART driver for EK-LM4F120XL Kit.
+ ******************************************************************************/
+
+#include <lm4f_120xl_uart.h>
+#include <inc/hw_uart.h>
+#include <inc/hw_udma.h>
+
+/* -------------------------------------------------------------------------- */
+
+#define RX_CH   8 // uDMA channel of UART0 RX
+#define TX_CH   9 // uDMA channel of UART0 TX
+#define ALT    32 // offset of the alternate control structures
+
+#define RX_CTL (UDMA_CHCTL_DSTINC_8    | UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_SRCINC_NONE | UDMA_CHCTL_SRCSIZE_8 | \
+                UDMA_CHCTL_ARBSIZE_8   | ((UART_DMA_CHUNK - 1) << UDMA_CHCTL_XFERSIZE_S) | UDMA_CHCTL_XFERMODE_PINGPONG)
+#define TX_CTL (UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_8 | UDMA_CHCTL_SRCINC_8    | UDMA_CHCTL_SRCSIZE_8 | \
+                UDMA_CHCTL_ARBSIZE_4   | UDMA_CHCTL_XFERMODE_BASIC)
+
+#define TX_MAX 1024 // max number of items of a single uDMA transfer
+
+#if (UART_DMA_CHUNK % 8) || (UART_DMA_CHUNK > 1024)
+#error Incorrect UART_DMA_CHUNK value!
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+typedef struct
+{
+	volatile const void * src;      // source end pointer
+	volatile       void * dst;      // destination end pointer
+	volatile   uint32_t   ctl;      // control word
+	           uint32_t   reserved;
+}	dma_t;
+
+static dma_t DMA[64] __ALIGNED(1024); // uDMA channel control table
+
+static struct
+{
+	stm_t *  rx;    // receive stream buffer
+	stm_t *  tx;    // transmit stream buffer
+	unsigned half;  // half of the ping-pong buffer expected to be completed first
+	size_t   done;  // number of bytes of this half already committed to the receive stream buffer
+	size_t   busy;  // number of bytes of the current uDMA transmission
+	uint32_t lost;  // number of lost bytes
+	char     buf[2][UART_DMA_CHUNK]; // receive ping-pong buffer
+}	UART;
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_rx_commit( const char *data, size_t size )
+{
+	void * buf;
+	size_t len;
+
+	while (size > 0 && (buf = stm_reserveISR(UART.rx, &len)) != NULL)
+	{
+		if (len > size) len = size;
+		memcpy(buf, data, len);
+		stm_commitISR(UART.rx, len);
+		data += len;
+		size -= len;
+	}
+
+	UART.lost += size;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_rx_arm( unsigned half )
+{
+	dma_t *ch = &DMA[RX_CH + half * ALT];
+
+	ch->src = &UART0->DR;
+	ch->dst = &UART.buf[half][UART_DMA_CHUNK - 1];
+	ch->ctl = RX_CTL;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_rx_update( void )
+{
+	dma_t *ch;
+	size_t size;
+
+	// completed halves of the ping-pong buffer
+	for (;;)
+	{
+		ch = &DMA[RX_CH + UART.half * ALT];
+		if ((ch->ctl & UDMA_CHCTL_XFERMODE_M) != UDMA_CHCTL_XFERMODE_STOP)
+			break;
+		priv_rx_commit(&UART.buf[UART.half][UART.done], UART_DMA_CHUNK - UART.done);
+		priv_rx_arm(UART.half);
+		UART.half ^= 1;
+		UART.done = 0;
+	}
+
+	// the active half of the ping-pong buffer
+	size = UART_DMA_CHUNK - 1 - ((ch->ctl & UDMA_CHCTL_XFERSIZE_M) >> UDMA_CHCTL_XFERSIZE_S);
+	if (size > UART.done)
+	{
+		priv_rx_commit(&UART.buf[UART.half][UART.done], size - UART.done);
+		UART.done = size;
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_rx_timeout( void )
+{
+	char   buf[16]; // size of the receive FIFO
+	size_t size = 0;
+
+	// the uDMA serves only burst requests; the rest of the data remains in the FIFO
+	UDMA->REQMASKSET = 1U << RX_CH;
+	priv_rx_update();
+	while ((UART0->FR & UART_FR_RXFE) == 0 && size < sizeof(buf))
+		buf[size++] = (char) UART0->DR;
+	priv_rx_commit(buf, size);
+	UDMA->REQMASKCLR = 1U << RX_CH;
+}
+
+/* -------------------------------------------------------------------------- */
+
+static
+void priv_tx_start( void )
+{
+	dma_t *ch = &DMA[TX_CH];
+	const char *data;
+	size_t size;
+
+	if (UART.busy == 0)
+	{
+		data = (const char *) stm_peekISR(UART.tx, &size);
+		if (data != NULL)
+		{
+			if (size > TX_MAX) size = TX_MAX;
+			ch->src = &data[size - 1];
+			ch->dst = &UART0->DR;
+			ch->ctl = TX_CTL | ((size - 1) << UDMA_CHCTL_XFERSIZE_S);
+			UART.busy = size;
+			UDMA->ENASET = 1U << TX_CH;
+		}
+	}
+}
+
+/* -------------------------------------------------------------------------- */
+
+void UART_Init( uint32_t baud, stm_t *rx, stm_t *tx )
+{
+	uint32_t div;
+
+	assert(baud);
+	assert(rx);
+	assert(tx);
+
+	UART.rx = rx;
+	UART.tx = tx;
+
+	BITBAND(SYSCTL->RCGCGPIO)[0] = 1; // GPIOA
+	BITBAND(SYSCTL->RCGCUART)[0] = 1; // UART0
+	BITBAND(SYSCTL->RCGCDMA)[0]  = 1; // uDMA
+	SYSCTL->RCGCDMA;
+
+	GPIOA->AFSEL |= 0x03;
+	GPIOA->PCTL   = (GPIOA->PCTL & ~0xFFU) | 0x11U;
+	GPIOA->DEN   |= 0x03;
+
+	UART0->CTL    = 0;
+	if (baud > CPU_FREQUENCY / 16)
+	{
+		// high-speed mode (8x oversampling)
+		div = (CPU_FREQUENCY * 16 / baud + 1) / 2;
+		UART0->CTL = UART_CTL_HSE;
+	}
+	else
+	{
+		div = (CPU_FREQUENCY * 8 / baud + 1) / 2;
+	}
+	UART0->IBRD   = div / 64;
+	UART0->FBRD   = div % 64;
+	UART0->LCRH   = UART_LCRH_WLEN_8 | UART_LCRH_FEN;
+	UART0->IFLS   = UART_IFLS_RX4_8 | UART_IFLS_TX4_8;
+	UART0->DMACTL = UART_DMACTL_RXDMAE | UART_DMACTL_TXDMAE;
+	UART0->IM     = UART_IM_RTIM;
+
+	UDMA->CFG     = UDMA_CFG_MASTEN;
+	UDMA->CTLBASE = (uint32_t)(uintptr_t) DMA;
+	UDMA->CHMAP1  = UDMA->CHMAP1 & ~0xFFU; // channels 8 and 9: UART0
+
+	UART.half = 0;
+	UART.done = 0;
+	priv_rx_arm(0);
+	priv_rx_arm(1);
+
+	UDMA->ALTCLR      = (1U << RX_CH) | (1U << TX_CH);
+	UDMA->USEBURSTSET = (1U << RX_CH); // the tail of data remains in the FIFO and raises the receive time-out
+	UDMA->REQMASKCLR  = (1U << RX_CH) | (1U << TX_CH);
+	UDMA->ENASET      = (1U << RX_CH);
+
+	UART0->CTL   |= UART_CTL_UARTEN | UART_CTL_TXE | UART_CTL_RXE;
+
+	NVIC_EnableIRQ(UART0_IRQn);
+}
+
+/* -------------------------------------------------------------------------- */
+
+int UART_Write( const void *data, size_t size, cnt_t delay )
+{
+	int result = stm_sendFor(UART.tx, data, size, delay);
+
+	if (result == E_SUCCESS)
+	{
+		sys_lock();
+		{
+			priv_tx_start();
+		}
+		sys_unlock();
+	}
+
+	return result;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int UART_Read( void *data, size_t size, size_t *read, cnt_t delay )
+{
+	return stm_waitFor(UART.rx, data, size, read, delay);
+}
+
+/* -------------------------------------------------------------------------- */
+
+uint32_t UART_Lost( void )
+{
+	return UART.lost;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void UART_Handler( void )
+{
+	uint32_t mis = UART0->MIS;
+	uint32_t chs = UDMA->CHIS & ((1U << RX_CH) | (1U << TX_CH));
+
+	UART0->ICR = mis;
+	UDMA->CHIS = chs;
+
+	sys_lockISR();
+	{
+		if (mis & UART_IM_RTIM)
+			priv_rx_timeout();
+		else
+		if (chs & (1U << RX_CH))
+			priv_rx_update();
+
+		if ((chs & (1U << TX_CH)) && (DMA[TX_CH].ctl & UDMA_CHCTL_XFERMODE_M) == UDMA_CHCTL_XFERMODE_STOP)
+		{
+			stm_consumeISR(UART.tx, UART.busy);
+			UART.busy = 0;
+			priv_tx_start();
+		}
+	}
+	sys_unlockISR();
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,64 @@
+/******************************************************************************
+ * @file    lm4f_120xl_uart.h
+ * @author  Rajmund Szymanski
+ * @date    17.10.2026
+ * @brief   This file contains definitions for EK-LM4F120XL Kit.
+ ******************************************************************************/
+
+#pragma once
+
+/* Includes ----------------------------------------------------------------- */
+
+#ifndef PART_LM4F120H5QR
+#define PART_LM4F120H5QR
+#endif
+#include <lm4f.h>
+#include <os.h>
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+extern "C" {
+#endif 
+
+/* Configuration ------------------------------------------------------------ */
+
+// size of a half of the receive ping-pong buffer (in bytes)
+// must be a multiple of 8 (the uDMA burst size), max 1024
+#ifndef UART_DMA_CHUNK
+#define UART_DMA_CHUNK 64
+#endif
+
+/* -------------------------------------------------------------------------- */
+
+// UART0 (PA0: RX, PA1: TX, virtual COM port of the ICDI) with uDMA channels 8 (RX) and 9 (TX)
+// received data is committed in blocks into the 'rx' stream buffer:
+//  - after each half of the ping-pong buffer is filled by the uDMA
+//  - after the receive time-out (the line is idle for 32 bit periods)
+// transmitted data is taken by the uDMA directly from the 'tx' stream buffer
+// readers may wait for data with stm_wait* functions on the 'rx' stream buffer
+// UART_Handler must be called from UART0_Handler:
+//  void UART0_Handler( void ) { UART_Handler(); }
+// the driver owns the uDMA channel control table
+
+void     UART_Init   ( uint32_t baud, stm_t *rx, stm_t *tx );
+
+// write data to the 'tx' stream buffer and start the transmission
+// return value as for stm_sendFor
+int      UART_Write  ( const void *data, size_t size, cnt_t delay );
+
+// read data from the 'rx' stream buffer
+// return value as for stm_waitFor
+int      UART_Read   ( void *data, size_t size, size_t *read, cnt_t delay );
+
+// return the number of received bytes lost because the 'rx' stream buffer was full
+uint32_t UART_Lost   ( void );
+
+// interrupt handler of the UART0 (and uDMA channels 8 and 9)
+void     UART_Handler( void );
+
+/* -------------------------------------------------------------------------- */
+
+#ifdef __cplusplus
+}
+#endif 